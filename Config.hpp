@@ -11,15 +11,43 @@ struct Result {
 
 
 template <class Wrapper>
-std::vector<Result> Config() {
+std::vector<Result> Config(const MeasureOptions& options = {}) {
 	// Initializers
 	auto initVec2 = &Wrapper::template RandomVec<typename Wrapper::Vec2>;
 	auto initVec3 = &Wrapper::template RandomVec<typename Wrapper::Vec3>;
 	auto initVec4 = &Wrapper::template RandomVec<typename Wrapper::Vec4>;
+	auto initIVec3 = &Wrapper::template RandomIntVec<typename Wrapper::IVec3>;
+	auto initIVec4 = &Wrapper::template RandomIntVec<typename Wrapper::IVec4>;
 
 	auto initMat22 = &Wrapper::template RandomMat<typename Wrapper::Mat22>;
 	auto initMat33 = &Wrapper::template RandomMat<typename Wrapper::Mat33>;
 	auto initMat44 = &Wrapper::template RandomMat<typename Wrapper::Mat44>;
+	auto initMat55 = &Wrapper::template RandomMat<typename Wrapper::Mat55>;
+	auto initMat66 = &Wrapper::template RandomMat<typename Wrapper::Mat66>;
+	auto initMat77 = &Wrapper::template RandomMat<typename Wrapper::Mat77>;
+	auto initMat88 = &Wrapper::template RandomMat<typename Wrapper::Mat88>;
+	auto initMat1616 = &Wrapper::template RandomMat<typename Wrapper::Mat1616>;
+	auto initMat3232 = &Wrapper::template RandomMat<typename Wrapper::Mat3232>;
+	auto initMat63 = &Wrapper::template RandomMat<typename Wrapper::Mat63>;
+
+	auto initQuat = &Wrapper::RandomQuat;
+	auto initRotation33 = &Wrapper::template RandomRotation<typename Wrapper::Mat33>;
+	auto initQuatBatch = &Wrapper::RandomQuatBatch;
+	auto initMat33Batch = &Wrapper::RandomMatBatch;
+	auto initSymmetric33 = &Wrapper::template RandomSymmetric<typename Wrapper::Mat33>;
+	auto initSymmetric44 = &Wrapper::template RandomSymmetric<typename Wrapper::Mat44>;
+	auto initSymmetric33Batch = &Wrapper::RandomSymmetricBatch;
+	auto initDeformation33 = &Wrapper::template RandomDeformation<typename Wrapper::Mat33>;
+	auto initVec6 = &Wrapper::template RandomVec<typename Wrapper::Vec6>;
+	auto initVec8 = &Wrapper::template RandomVec<typename Wrapper::Vec8>;
+	auto initPositiveVec8 = &Wrapper::template RandomPositiveVec<typename Wrapper::Vec8>;
+	auto initSPD33 = &Wrapper::template RandomSPD<typename Wrapper::Mat33>;
+	auto initSPD66 = &Wrapper::template RandomSPD<typename Wrapper::Mat66>;
+	auto initVec3Batch = &Wrapper::template RandomVecBatch<typename Wrapper::Vec3Batch>;
+	auto initVec6Batch = &Wrapper::template RandomVecBatch<typename Wrapper::Vec6Batch>;
+	auto initVec2Array = &Wrapper::RandomVec2Array;
+	auto initSPD33Batch = &Wrapper::template RandomSPDBatch<typename Wrapper::Mat33Batch>;
+	auto initSPD66Batch = &Wrapper::template RandomSPDBatch<typename Wrapper::Mat66Batch>;
 
 	// Test: vector elementwise
 	auto mulVec2 = &Wrapper::template MulVV<typename Wrapper::Vec2>;
@@ -38,11 +66,23 @@ std::vector<Result> Config() {
 	auto mulMat22 = &Wrapper::template MulMM<typename Wrapper::Mat22, typename Wrapper::Mat22>;
 	auto mulMat33 = &Wrapper::template MulMM<typename Wrapper::Mat33, typename Wrapper::Mat33>;
 	auto mulMat44 = &Wrapper::template MulMM<typename Wrapper::Mat44, typename Wrapper::Mat44>;
+	auto mulMat88 = &Wrapper::template MulMM<typename Wrapper::Mat88, typename Wrapper::Mat88>;
+	auto mulMat1616 = &Wrapper::template MulMM<typename Wrapper::Mat1616, typename Wrapper::Mat1616>;
+	auto mulMat3232 = &Wrapper::template MulMM<typename Wrapper::Mat3232, typename Wrapper::Mat3232>;
 
 	auto addMat22 = &Wrapper::template AddMM<typename Wrapper::Mat22>;
 	auto addMat33 = &Wrapper::template AddMM<typename Wrapper::Mat33>;
 	auto addMat44 = &Wrapper::template AddMM<typename Wrapper::Mat44>;
 
+	// Test: matrix-vector
+	auto mulMat33Vec3 = &Wrapper::template MulMV<typename Wrapper::Mat33, typename Wrapper::Vec3>;
+	auto mulMat44Vec4 = &Wrapper::template MulMV<typename Wrapper::Mat44, typename Wrapper::Vec4>;
+	auto transformMat44Vec3 = &Wrapper::template TransformMV<typename Wrapper::Mat44, typename Wrapper::Vec3>;
+
+	auto mulVec3Mat33 = &Wrapper::template MulVM<typename Wrapper::Vec3, typename Wrapper::Mat33>;
+	auto mulVec4Mat44 = &Wrapper::template MulVM<typename Wrapper::Vec4, typename Wrapper::Mat44>;
+	auto transformVec3Mat44 = &Wrapper::template TransformVM<typename Wrapper::Vec3, typename Wrapper::Mat44>;
+
 	// Test: dot & cross
 	auto dot2 = &Wrapper::template Dot<typename Wrapper::Vec2>;
 	auto dot3 = &Wrapper::template Dot<typename Wrapper::Vec3>;
@@ -53,19 +93,68 @@ std::vector<Result> Config() {
 	auto norm2 = &Wrapper::template NormV<typename Wrapper::Vec2>;
 	auto norm3 = &Wrapper::template NormV<typename Wrapper::Vec3>;
 	auto norm4 = &Wrapper::template NormV<typename Wrapper::Vec4>;
+	auto normFast2 = &Wrapper::template NormFastV<typename Wrapper::Vec2>;
+	auto normFast3 = &Wrapper::template NormFastV<typename Wrapper::Vec3>;
+	auto normFast4 = &Wrapper::template NormFastV<typename Wrapper::Vec4>;
 
 	auto normalize2 = &Wrapper::template NormalizeV<typename Wrapper::Vec2>;
 	auto normalize3 = &Wrapper::template NormalizeV<typename Wrapper::Vec3>;
 	auto normalize4 = &Wrapper::template NormalizeV<typename Wrapper::Vec4>;
+	auto normalizeFast2 = &Wrapper::template NormalizeFastV<typename Wrapper::Vec2>;
+	auto normalizeFast3 = &Wrapper::template NormalizeFastV<typename Wrapper::Vec3>;
+	auto normalizeFast4 = &Wrapper::template NormalizeFastV<typename Wrapper::Vec4>;
+	auto normalizeArray2 = &Wrapper::NormalizeArray;
+
+	// Test: vector utility functions
+	auto minVec4 = &Wrapper::template MinVV<typename Wrapper::Vec4>;
+	auto maxVec4 = &Wrapper::template MaxVV<typename Wrapper::Vec4>;
+	auto clampVec3 = &Wrapper::template ClampV<typename Wrapper::Vec3>;
+	auto clampVec4 = &Wrapper::template ClampV<typename Wrapper::Vec4>;
+	auto absVec4 = &Wrapper::template AbsV<typename Wrapper::Vec4>;
+	auto floorVec4 = &Wrapper::template FloorV<typename Wrapper::Vec4>;
+	auto roundVec4 = &Wrapper::template RoundV<typename Wrapper::Vec4>;
+	auto lerpVec3 = &Wrapper::template LerpVV<typename Wrapper::Vec3>;
+	auto lerpVec4 = &Wrapper::template LerpVV<typename Wrapper::Vec4>;
+	auto smoothstepVec4 = &Wrapper::template SmoothstepV<typename Wrapper::Vec4>;
+
+	// Test: vector comparison
+	auto anyLessVec3 = &Wrapper::template AnyLessVV<typename Wrapper::Vec3>;
+	auto anyLessVec4 = &Wrapper::template AnyLessVV<typename Wrapper::Vec4>;
+	auto selectLessVec4 = &Wrapper::template SelectLessVV<typename Wrapper::Vec4>;
+
+	// Test: integer vectors
+	auto addIVec3 = &Wrapper::template AddVV<typename Wrapper::IVec3>;
+	auto addIVec4 = &Wrapper::template AddVV<typename Wrapper::IVec4>;
+	auto mulIVec4 = &Wrapper::template MulVV<typename Wrapper::IVec4>;
+	auto minIVec4 = &Wrapper::template MinVV<typename Wrapper::IVec4>;
+	auto shiftRightIVec4 = &Wrapper::template ShiftRightV<typename Wrapper::IVec4>;
+	auto cellIndexVec4 = &Wrapper::CellIndexV;
+
+	// Test: elementary functions
+	auto sinVec8 = &Wrapper::template SinV<typename Wrapper::Vec8>;
+	auto cosVec8 = &Wrapper::template CosV<typename Wrapper::Vec8>;
+	auto sinCosVec4 = &Wrapper::template SinCosV<typename Wrapper::Vec4>;
+	auto sinCosVec8 = &Wrapper::template SinCosV<typename Wrapper::Vec8>;
+	auto atan2Vec8 = &Wrapper::template Atan2VV<typename Wrapper::Vec8>;
+	auto acosVec8 = &Wrapper::template AcosV<typename Wrapper::Vec8>;
+	auto expVec8 = &Wrapper::template ExpV<typename Wrapper::Vec8>;
+	auto logVec8 = &Wrapper::template LogV<typename Wrapper::Vec8>;
 
 	// Test: matrix functions
 	auto determinant2 = &Wrapper::template Determinant<typename Wrapper::Mat22>;
 	auto determinant3 = &Wrapper::template Determinant<typename Wrapper::Mat33>;
 	auto determinant4 = &Wrapper::template Determinant<typename Wrapper::Mat44>;
+	auto determinant5 = &Wrapper::template Determinant<typename Wrapper::Mat55>;
+	auto determinant6 = &Wrapper::template Determinant<typename Wrapper::Mat66>;
+	auto inverseDeterminant4 = &Wrapper::template InverseDeterminant<typename Wrapper::Mat44>;
 
 	auto inverse2 = &Wrapper::template Inverse<typename Wrapper::Mat22>;
 	auto inverse3 = &Wrapper::template Inverse<typename Wrapper::Mat33>;
 	auto inverse4 = &Wrapper::template Inverse<typename Wrapper::Mat44>;
+	auto inverse5 = &Wrapper::template Inverse<typename Wrapper::Mat55>;
+	auto inverse6 = &Wrapper::template Inverse<typename Wrapper::Mat66>;
+	auto inverse7 = &Wrapper::template Inverse<typename Wrapper::Mat77>;
+	auto inverse8 = &Wrapper::template Inverse<typename Wrapper::Mat88>;
 
 	auto trace2 = &Wrapper::template Trace<typename Wrapper::Mat22>;
 	auto trace3 = &Wrapper::template Trace<typename Wrapper::Mat33>;
@@ -74,69 +163,212 @@ std::vector<Result> Config() {
 	auto transpose22 = &Wrapper::template Transpose<typename Wrapper::Mat22>;
 	auto transpose33 = &Wrapper::template Transpose<typename Wrapper::Mat33>;
 	auto transpose44 = &Wrapper::template Transpose<typename Wrapper::Mat44>;
+	auto transpose88 = &Wrapper::template Transpose<typename Wrapper::Mat88>;
+	auto convertLayout44 = &Wrapper::template ConvertLayout<typename Wrapper::Mat44>;
+	auto convertLayout88 = &Wrapper::template ConvertLayout<typename Wrapper::Mat88>;
 	
+	// Test: quaternion
+	auto mulQuat = &Wrapper::MulQQ;
+	auto rotateQuatVec3 = &Wrapper::template RotateQV<typename Wrapper::Vec3>;
+	auto normalizeQuat = &Wrapper::NormalizeQ;
+	auto conjugateQuat = &Wrapper::ConjugateQ;
+	auto inverseQuat = &Wrapper::InverseQ;
+	auto quatToMat33 = &Wrapper::template ToMatrixQ<typename Wrapper::Mat33>;
+	auto quatToMat44 = &Wrapper::template ToMatrixQ<typename Wrapper::Mat44>;
+	auto mat33ToQuat = &Wrapper::template FromMatrixQ<typename Wrapper::Mat33>;
+	auto expQuat = &Wrapper::ExpQ;
+	auto logQuat = &Wrapper::LogQ;
+	auto powQuat = &Wrapper::PowQ;
+	auto slerpQuat = &Wrapper::SlerpQQ;
+
+	// Test: pose blending, a pass over the operands blends two 10k bone poses unless the size is set explicitly
+	auto slerpPose = &Wrapper::SlerpBatch;
+	auto nlerpPose = &Wrapper::NlerpBatch;
+
+	MeasureOptions poseOptions = options;
+	poseOptions.size = options.size != 0 ? options.size : 10000 / 8;
+
 	auto pow3mat44 = &Wrapper::template Pow3M<typename Wrapper::Mat44>;
 	
+	auto svd33 = &Wrapper::template SingularValueDec<typename Wrapper::Mat33>;
 	auto svd44 = &Wrapper::template SingularValueDec<typename Wrapper::Mat44>;
+	auto svd33Batch = &Wrapper::SingularValueDecBatch;
 
+	auto eigen33 = &Wrapper::template EigenSymmetric<typename Wrapper::Mat33>;
+	auto eigen44 = &Wrapper::template EigenSymmetric<typename Wrapper::Mat44>;
+	auto eigen33Batch = &Wrapper::EigenSymmetricBatch;
 
-	std::vector<Result> results = {
-		{ "Vec2 * Vec2", MeasureBinaryKernel(mulVec2, initVec2, initVec2) },
-		{ "Vec3 * Vec3", MeasureBinaryKernel(mulVec3, initVec3, initVec3) },
-		{ "Vec4 * Vec4", MeasureBinaryKernel(mulVec4, initVec4, initVec4) },
-
-		{ "Vec2 + Vec2", MeasureBinaryKernel(addVec2, initVec2, initVec2) },
-		{ "Vec3 + Vec3", MeasureBinaryKernel(addVec3, initVec3, initVec3) },
-		{ "Vec4 + Vec4", MeasureBinaryKernel(addVec4, initVec4, initVec4) },
-
-		{ "Vec2 / Vec2", MeasureBinaryKernel(divVec2, initVec2, initVec2) },
-		{ "Vec3 / Vec3", MeasureBinaryKernel(divVec3, initVec3, initVec3) },
-		{ "Vec4 / Vec4", MeasureBinaryKernel(divVec4, initVec4, initVec4) },
-
-
-		{ "Mat22 * Mat22", MeasureBinaryKernel(mulMat22, initMat22, initMat22) },
-		{ "Mat33 * Mat33", MeasureBinaryKernel(mulMat33, initMat33, initMat33) },
-		{ "Mat44 * Mat44", MeasureBinaryKernel(mulMat44, initMat44, initMat44) },
-
-		{ "Mat22 + Mat22", MeasureBinaryKernel(addMat22, initMat22, initMat22) },
-		{ "Mat33 + Mat33", MeasureBinaryKernel(addMat33, initMat33, initMat33) },
-		{ "Mat44 + Mat44", MeasureBinaryKernel(addMat44, initMat44, initMat44) },
+	auto polar33 = &Wrapper::template PolarDec<typename Wrapper::Mat33>;
 
+	auto qr44 = &Wrapper::template QRDec<typename Wrapper::Mat44>;
+	auto qr66 = &Wrapper::template QRDec<typename Wrapper::Mat66>;
+	auto leastSquares63 = &Wrapper::template LeastSquares<typename Wrapper::Mat63, typename Wrapper::Vec6>;
+	auto lu66 = &Wrapper::template LUSolve<typename Wrapper::Mat66, typename Wrapper::Vec6>;
+	auto lu88 = &Wrapper::template LUSolve<typename Wrapper::Mat88, typename Wrapper::Vec8>;
+	auto cholesky33 = &Wrapper::template CholeskySolve<typename Wrapper::Mat33, typename Wrapper::Vec3>;
+	auto cholesky66 = &Wrapper::template CholeskySolve<typename Wrapper::Mat66, typename Wrapper::Vec6>;
+	auto ldlt33 = &Wrapper::template LDLTSolve<typename Wrapper::Mat33, typename Wrapper::Vec3>;
+	auto ldlt66 = &Wrapper::template LDLTSolve<typename Wrapper::Mat66, typename Wrapper::Vec6>;
+	auto cholesky33Batch = &Wrapper::template CholeskySolveBatch<typename Wrapper::Mat33Batch, typename Wrapper::Vec3Batch>;
+	auto cholesky66Batch = &Wrapper::template CholeskySolveBatch<typename Wrapper::Mat66Batch, typename Wrapper::Vec6Batch>;
+	auto ldlt66Batch = &Wrapper::template LDLTSolveBatch<typename Wrapper::Mat66Batch, typename Wrapper::Vec6Batch>;
 
-		{ "Vec2 . Vec2", MeasureBinaryKernel(dot2, initVec2, initVec2) },
-		{ "Vec3 . Vec3", MeasureBinaryKernel(dot3, initVec3, initVec3) },
-		{ "Vec4 . Vec4", MeasureBinaryKernel(dot4, initVec4, initVec4) },
-		{ "Vec3 x Vec3", MeasureBinaryKernel(cross, initVec3, initVec3) },
 
-
-		{ "norm(Vec2)", MeasureUnaryKernel(norm2, initVec2) },
-		{ "norm(Vec3)", MeasureUnaryKernel(norm3, initVec3) },
-		{ "norm(Vec4)", MeasureUnaryKernel(norm4, initVec4) },
-
-		{ "normalize(Vec2)", MeasureUnaryKernel(normalize2, initVec2) },
-		{ "normalize(Vec3)", MeasureUnaryKernel(normalize3, initVec3) },
-		{ "normalize(Vec4)", MeasureUnaryKernel(normalize4, initVec4) },
-
-
-		{ "determinant(Mat22)", MeasureUnaryKernel(determinant2, initMat22) },
-		{ "determinant(Mat33)", MeasureUnaryKernel(determinant3, initMat33) },
-		{ "determinant(Mat44)", MeasureUnaryKernel(determinant4, initMat44) },
-
-		{ "inverse(Mat22)", MeasureUnaryKernel(inverse2, initMat22) },
-		{ "inverse(Mat33)", MeasureUnaryKernel(inverse3, initMat33) },
-		{ "inverse(Mat44)", MeasureUnaryKernel(inverse4, initMat44) },
-
-		{ "trace(Mat22)", MeasureUnaryKernel(trace2, initMat22) },
-		{ "trace(Mat33)", MeasureUnaryKernel(trace3, initMat33) },
-		{ "trace(Mat44)", MeasureUnaryKernel(trace4, initMat44) },
-
-		{ "transpose(Mat22)", MeasureUnaryKernel(transpose22, initMat22) },
-		{ "transpose(Mat33)", MeasureUnaryKernel(transpose33, initMat33) },
-		{ "transpose(Mat44)", MeasureUnaryKernel(transpose44, initMat44) },
+	std::vector<Result> results = {
+		{ "Vec2 * Vec2", MeasureBinaryKernel(mulVec2, initVec2, initVec2, options) },
+		{ "Vec3 * Vec3", MeasureBinaryKernel(mulVec3, initVec3, initVec3, options) },
+		{ "Vec4 * Vec4", MeasureBinaryKernel(mulVec4, initVec4, initVec4, options) },
+
+		{ "Vec2 + Vec2", MeasureBinaryKernel(addVec2, initVec2, initVec2, options) },
+		{ "Vec3 + Vec3", MeasureBinaryKernel(addVec3, initVec3, initVec3, options) },
+		{ "Vec4 + Vec4", MeasureBinaryKernel(addVec4, initVec4, initVec4, options) },
+
+		{ "Vec2 / Vec2", MeasureBinaryKernel(divVec2, initVec2, initVec2, options) },
+		{ "Vec3 / Vec3", MeasureBinaryKernel(divVec3, initVec3, initVec3, options) },
+		{ "Vec4 / Vec4", MeasureBinaryKernel(divVec4, initVec4, initVec4, options) },
+
+
+		{ "Mat22 * Mat22", MeasureBinaryKernel(mulMat22, initMat22, initMat22, options) },
+		{ "Mat33 * Mat33", MeasureBinaryKernel(mulMat33, initMat33, initMat33, options) },
+		{ "Mat44 * Mat44", MeasureBinaryKernel(mulMat44, initMat44, initMat44, options) },
+		{ "Mat88 * Mat88", MeasureBinaryKernel(mulMat88, initMat88, initMat88, options) },
+		{ "Mat1616 * Mat1616", MeasureBinaryKernel(mulMat1616, initMat1616, initMat1616, options) },
+		{ "Mat3232 * Mat3232", MeasureBinaryKernel(mulMat3232, initMat3232, initMat3232, options) },
+
+		{ "Mat22 + Mat22", MeasureBinaryKernel(addMat22, initMat22, initMat22, options) },
+		{ "Mat33 + Mat33", MeasureBinaryKernel(addMat33, initMat33, initMat33, options) },
+		{ "Mat44 + Mat44", MeasureBinaryKernel(addMat44, initMat44, initMat44, options) },
+
+
+		{ "Mat33 * Vec3", MeasureBinaryKernel(mulMat33Vec3, initMat33, initVec3, options) },
+		{ "Mat44 * Vec4", MeasureBinaryKernel(mulMat44Vec4, initMat44, initVec4, options) },
+		{ "Mat44 * (Vec3|1)", MeasureBinaryKernel(transformMat44Vec3, initMat44, initVec3, options) },
+
+		{ "Vec3 * Mat33", MeasureBinaryKernel(mulVec3Mat33, initVec3, initMat33, options) },
+		{ "Vec4 * Mat44", MeasureBinaryKernel(mulVec4Mat44, initVec4, initMat44, options) },
+		{ "(Vec3|1) * Mat44", MeasureBinaryKernel(transformVec3Mat44, initVec3, initMat44, options) },
+
+
+		{ "Vec2 . Vec2", MeasureBinaryKernel(dot2, initVec2, initVec2, options) },
+		{ "Vec3 . Vec3", MeasureBinaryKernel(dot3, initVec3, initVec3, options) },
+		{ "Vec4 . Vec4", MeasureBinaryKernel(dot4, initVec4, initVec4, options) },
+		{ "Vec3 x Vec3", MeasureBinaryKernel(cross, initVec3, initVec3, options) },
+
+
+		{ "norm(Vec2)", MeasureUnaryKernel(norm2, initVec2, options) },
+		{ "norm(Vec3)", MeasureUnaryKernel(norm3, initVec3, options) },
+		{ "norm(Vec4)", MeasureUnaryKernel(norm4, initVec4, options) },
+		{ "fast norm(Vec2)", MeasureUnaryKernel(normFast2, initVec2, options) },
+		{ "fast norm(Vec3)", MeasureUnaryKernel(normFast3, initVec3, options) },
+		{ "fast norm(Vec4)", MeasureUnaryKernel(normFast4, initVec4, options) },
+
+		{ "normalize(Vec2)", MeasureUnaryKernel(normalize2, initVec2, options) },
+		{ "normalize(Vec3)", MeasureUnaryKernel(normalize3, initVec3, options) },
+		{ "normalize(Vec4)", MeasureUnaryKernel(normalize4, initVec4, options) },
+		{ "fast normalize(Vec2)", MeasureUnaryKernel(normalizeFast2, initVec2, options) },
+		{ "fast normalize(Vec3)", MeasureUnaryKernel(normalizeFast3, initVec3, options) },
+		{ "fast normalize(Vec4)", MeasureUnaryKernel(normalizeFast4, initVec4, options) },
+		{ "normalize(Vec2) (8 vectors)", MeasureUnaryKernel(normalizeArray2, initVec2Array, options) },
+
+
+		{ "min(Vec4, Vec4)", MeasureBinaryKernel(minVec4, initVec4, initVec4, options) },
+		{ "max(Vec4, Vec4)", MeasureBinaryKernel(maxVec4, initVec4, initVec4, options) },
+		{ "clamp(Vec3)", MeasureUnaryKernel(clampVec3, initVec3, options) },
+		{ "clamp(Vec4)", MeasureUnaryKernel(clampVec4, initVec4, options) },
+		{ "abs(Vec4)", MeasureUnaryKernel(absVec4, initVec4, options) },
+		{ "floor(Vec4)", MeasureUnaryKernel(floorVec4, initVec4, options) },
+		{ "round(Vec4)", MeasureUnaryKernel(roundVec4, initVec4, options) },
+		{ "lerp(Vec3, Vec3)", MeasureBinaryKernel(lerpVec3, initVec3, initVec3, options) },
+		{ "lerp(Vec4, Vec4)", MeasureBinaryKernel(lerpVec4, initVec4, initVec4, options) },
+		{ "smoothstep(Vec4)", MeasureUnaryKernel(smoothstepVec4, initVec4, options) },
+
+		{ "any(Vec3 < Vec3)", MeasureBinaryKernel(anyLessVec3, initVec3, initVec3, options) },
+		{ "any(Vec4 < Vec4)", MeasureBinaryKernel(anyLessVec4, initVec4, initVec4, options) },
+		{ "select(Vec4 < Vec4)", MeasureBinaryKernel(selectLessVec4, initVec4, initVec4, options) },
+
+		{ "IVec3 + IVec3", MeasureBinaryKernel(addIVec3, initIVec3, initIVec3, options) },
+		{ "IVec4 + IVec4", MeasureBinaryKernel(addIVec4, initIVec4, initIVec4, options) },
+		{ "IVec4 * IVec4", MeasureBinaryKernel(mulIVec4, initIVec4, initIVec4, options) },
+		{ "min(IVec4, IVec4)", MeasureBinaryKernel(minIVec4, initIVec4, initIVec4, options) },
+		{ "IVec4 >> 4", MeasureUnaryKernel(shiftRightIVec4, initIVec4, options) },
+		{ "cell index(Vec4)", MeasureUnaryKernel(cellIndexVec4, initVec4, options) },
+		{ "sin(Vec8)", MeasureUnaryKernel(sinVec8, initVec8, options) },
+		{ "cos(Vec8)", MeasureUnaryKernel(cosVec8, initVec8, options) },
+		{ "sincos(Vec4)", MeasureUnaryKernel(sinCosVec4, initVec4, options) },
+		{ "sincos(Vec8)", MeasureUnaryKernel(sinCosVec8, initVec8, options) },
+		{ "atan2(Vec8, Vec8)", MeasureBinaryKernel(atan2Vec8, initVec8, initVec8, options) },
+		{ "acos(Vec8)", MeasureUnaryKernel(acosVec8, initVec8, options) },
+		{ "exp(Vec8)", MeasureUnaryKernel(expVec8, initVec8, options) },
+		{ "log(Vec8)", MeasureUnaryKernel(logVec8, initPositiveVec8, options) },
+
+
+		{ "determinant(Mat22)", MeasureUnaryKernel(determinant2, initMat22, options) },
+		{ "determinant(Mat33)", MeasureUnaryKernel(determinant3, initMat33, options) },
+		{ "determinant(Mat44)", MeasureUnaryKernel(determinant4, initMat44, options) },
+		{ "determinant(Mat55)", MeasureUnaryKernel(determinant5, initMat55, options) },
+		{ "determinant(Mat66)", MeasureUnaryKernel(determinant6, initMat66, options) },
+
+		{ "inverse(Mat22)", MeasureUnaryKernel(inverse2, initMat22, options) },
+		{ "inverse(Mat33)", MeasureUnaryKernel(inverse3, initMat33, options) },
+		{ "inverse(Mat44)", MeasureUnaryKernel(inverse4, initMat44, options) },
+		{ "inverse+determinant(Mat44)", MeasureUnaryKernel(inverseDeterminant4, initMat44, options) },
+		{ "inverse(Mat55)", MeasureUnaryKernel(inverse5, initMat55, options) },
+		{ "inverse(Mat66)", MeasureUnaryKernel(inverse6, initMat66, options) },
+		{ "inverse(Mat77)", MeasureUnaryKernel(inverse7, initMat77, options) },
+		{ "inverse(Mat88)", MeasureUnaryKernel(inverse8, initMat88, options) },
+
+		{ "trace(Mat22)", MeasureUnaryKernel(trace2, initMat22, options) },
+		{ "trace(Mat33)", MeasureUnaryKernel(trace3, initMat33, options) },
+		{ "trace(Mat44)", MeasureUnaryKernel(trace4, initMat44, options) },
+
+		{ "transpose(Mat22)", MeasureUnaryKernel(transpose22, initMat22, options) },
+		{ "transpose(Mat33)", MeasureUnaryKernel(transpose33, initMat33, options) },
+		{ "transpose(Mat44)", MeasureUnaryKernel(transpose44, initMat44, options) },
+		{ "transpose(Mat88)", MeasureUnaryKernel(transpose88, initMat88, options) },
+		{ "layout(Mat44)", MeasureUnaryKernel(convertLayout44, initMat44, options) },
+		{ "layout(Mat88)", MeasureUnaryKernel(convertLayout88, initMat88, options) },
 		
-		{ "Mat44^3", MeasureUnaryKernel(pow3mat44, initMat44) },
+		{ "Quat * Quat", MeasureBinaryKernel(mulQuat, initQuat, initQuat, options) },
+		{ "Quat * Vec3", MeasureBinaryKernel(rotateQuatVec3, initQuat, initVec3, options) },
+		{ "normalize(Quat)", MeasureUnaryKernel(normalizeQuat, initQuat, options) },
+		{ "conjugate(Quat)", MeasureUnaryKernel(conjugateQuat, initQuat, options) },
+		{ "inverse(Quat)", MeasureUnaryKernel(inverseQuat, initQuat, options) },
+		{ "Quat -> Mat33", MeasureUnaryKernel(quatToMat33, initQuat, options) },
+		{ "Quat -> Mat44", MeasureUnaryKernel(quatToMat44, initQuat, options) },
+		{ "Mat33 -> Quat", MeasureUnaryKernel(mat33ToQuat, initRotation33, options) },
+		{ "exp(Quat)", MeasureUnaryKernel(expQuat, initQuat, options) },
+		{ "log(Quat)", MeasureUnaryKernel(logQuat, initQuat, options) },
+		{ "pow(Quat)", MeasureUnaryKernel(powQuat, initQuat, options) },
+		{ "slerp(Quat, Quat)", MeasureBinaryKernel(slerpQuat, initQuat, initQuat, options) },
+
+		{ "slerp pose (8 bones)", MeasureBinaryKernel(slerpPose, initQuatBatch, initQuatBatch, poseOptions) },
+		{ "nlerp pose (8 bones)", MeasureBinaryKernel(nlerpPose, initQuatBatch, initQuatBatch, poseOptions) },
+
+
+		{ "Mat44^3", MeasureUnaryKernel(pow3mat44, initMat44, options) },
 		
-		{ "SVD 4x4", MeasureUnaryKernel(svd44, initMat44) },
+		{ "SVD 3x3", MeasureUnaryKernel(svd33, initMat33, options) },
+		{ "SVD 4x4", MeasureUnaryKernel(svd44, initMat44, options) },
+		{ "SVD 3x3 (8 matrices)", MeasureUnaryKernel(svd33Batch, initMat33Batch, options) },
+
+		{ "eigen symmetric 3x3", MeasureUnaryKernel(eigen33, initSymmetric33, options) },
+		{ "eigen symmetric 4x4", MeasureUnaryKernel(eigen44, initSymmetric44, options) },
+		{ "eigen symmetric 3x3 (8 matrices)", MeasureUnaryKernel(eigen33Batch, initSymmetric33Batch, options) },
+
+		{ "polar 3x3", MeasureUnaryKernel(polar33, initDeformation33, options) },
+
+		{ "QR 4x4", MeasureUnaryKernel(qr44, initMat44, options) },
+		{ "QR 6x6", MeasureUnaryKernel(qr66, initMat66, options) },
+		{ "least squares 6x3", MeasureBinaryKernel(leastSquares63, initMat63, initVec6, options) },
+		{ "LU solve 6x6", MeasureBinaryKernel(lu66, initMat66, initVec6, options) },
+		{ "LU solve 8x8", MeasureBinaryKernel(lu88, initMat88, initVec8, options) },
+		{ "cholesky solve 3x3", MeasureBinaryKernel(cholesky33, initSPD33, initVec3, options) },
+		{ "cholesky solve 6x6", MeasureBinaryKernel(cholesky66, initSPD66, initVec6, options) },
+		{ "LDLT solve 3x3", MeasureBinaryKernel(ldlt33, initSPD33, initVec3, options) },
+		{ "LDLT solve 6x6", MeasureBinaryKernel(ldlt66, initSPD66, initVec6, options) },
+		{ "cholesky solve 3x3 (8 systems)", MeasureBinaryKernel(cholesky33Batch, initSPD33Batch, initVec3Batch, options) },
+		{ "cholesky solve 6x6 (8 systems)", MeasureBinaryKernel(cholesky66Batch, initSPD66Batch, initVec6Batch, options) },
+		{ "LDLT solve 6x6 (8 systems)", MeasureBinaryKernel(ldlt66Batch, initSPD66Batch, initVec6Batch, options) },
 	};
 
 	return results;
@@ -3,14 +3,27 @@
 #include <chrono>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <random>
+
+#include "Memory.hpp"
+#include "Process.hpp"
 
 
 #ifdef _MSC_VER
 #include <intrin.h>
 #define USE_RDTSC
+#define USE_CLFLUSH
+#define NOINLINE __declspec(noinline)
 #elif __GNUC__
 #include <x86intrin.h>
 #define USE_RDTSC
+#define USE_CLFLUSH
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE
 #endif
 
 
@@ -19,6 +32,11 @@ struct Timing {
 	unsigned long long cyclesTotal;
 	double timePerOpNs;
 	double cyclesPerOp;
+	size_t alignment;
+	double lineSplitRatio;
+	size_t pageSize;
+	uint64_t contextSwitches;
+	uint64_t interrupts;
 };
 
 struct Measurement {
@@ -31,8 +49,51 @@ struct Measurement {
 	int numTimesRun;
 	int size;
 	int rep;
+	/// <summary> The alignment of the operand and result arrays' start addresses, capped at the cache line size. </summary>
+	size_t alignment;
+	/// <summary> The fraction of operands and results that straddle a cache line boundary, thus need split loads or stores. </summary>
+	double lineSplitRatio;
+	/// <summary> The size of the memory pages backing the operands. Huge pages may silently be unavailable, so this is the smallest of all samples. </summary>
+	size_t pageSize;
+	/// <summary> The number of samples that were discarded because the thread was preempted or interrupted during them. </summary>
+	/// <remarks> If every sample was contaminated, none are discarded, but the count still reflects the contamination. </remarks>
+	int numContaminated;
+};
+
+
+/// <summary> Selects the state of the caches at the start of each timed pass. </summary>
+enum class eCacheMode {
+	/// <summary> Operands stay cached between passes, like a tight loop over the same data. </summary>
+	WARM,
+	/// <summary> Operands are flushed from all cache levels before each pass, like per-frame updates over evicted data. </summary>
+	COLD,
+};
+
+/// <summary> Selects the order in which the operands are fetched. </summary>
+enum class eAccessPattern {
+	/// <summary> Operands are streamed in memory order. </summary>
+	SEQUENTIAL,
+	/// <summary> Operands are fetched through a random permutation, like indices into a shared palette. </summary>
+	RANDOM,
+	/// <summary> Runs of consecutive operands are fetched in random order, like bone chains of a skeleton. </summary>
+	CLUSTERED,
+	/// <summary> Operands are fetched with a fixed stride of several cache lines, like a column of an SoA table. </summary>
+	STRIDED,
 };
 
+struct MeasureOptions {
+	eCacheMode cacheMode = eCacheMode::WARM;
+	/// <summary> Runs random conditional and indirect branches before each pass to wipe the predictor's history. </summary>
+	bool scrambleBranches = false;
+	OperandPlacement placement;
+	/// <summary> Input operands other than sequential are fetched through an index array, results are always written sequentially. </summary>
+	eAccessPattern accessPattern = eAccessPattern::SEQUENTIAL;
+	/// <summary> The number of elements in each operand array. Zero picks a size that fits the L1 cache. </summary>
+	/// <remarks> Repetitions and samples are reduced for large sizes to keep the run time bounded. </remarks>
+	size_t size = 0;
+};
+
+
 uint64_t ReadTSC() {
 #ifdef USE_RDTSC
 	return (uint64_t)__rdtsc();
@@ -42,121 +103,364 @@ uint64_t ReadTSC() {
 }
 
 
-template <class Lhs, class Rhs, class Result, class InitLhs, class InitRhs>
-Timing BinaryKernel(Result (*binaryOp)(const Lhs&, const Rhs&), const InitLhs& initLhs, const InitRhs& initRhs, size_t size, size_t repeat) {
-	std::vector<Lhs> lhs(size);
-	std::vector<Rhs> rhs(size);
-	for (size_t i = 0; i < size; ++i) {
-		initLhs(lhs[i]);
-		initRhs(rhs[i]);
+/// <summary> Removes the memory of <paramref name="buffer"/> from every level of the cache hierarchy. </summary>
+/// <remarks> Without clflush, a buffer larger than any last level cache is swept instead. </remarks>
+template <class T>
+void EvictFromCache(const OperandArray<T>& buffer) {
+	if (buffer.empty()) {
+		return;
+	}
+#ifdef USE_CLFLUSH
+	const char* first = reinterpret_cast<const char*>(buffer.data());
+	const char* last = first + buffer.size() * sizeof(T) - 1;
+	for (const char* line = first; line <= last; line += CacheLineSize) {
+		_mm_clflush(line);
+	}
+	_mm_clflush(last);
+#else
+	static std::vector<char> sweep(64 * 1024 * 1024);
+	volatile char sink = 0;
+	for (size_t i = 0; i < sweep.size(); i += CacheLineSize) {
+		sweep[i] += 1;
+		sink = sweep[i];
 	}
+#endif
+}
 
-	std::chrono::high_resolution_clock::time_point start, end;
-	uint64_t startClk, endClk;
 
-	if constexpr (!std::is_void_v<Result>) {
-		std::vector<Result> result(size);
+namespace impl {
+template <unsigned N>
+NOINLINE unsigned ScrambleTarget(unsigned x) {
+	return x * (2 * N + 1) + N;
+}
 
-		start = std::chrono::high_resolution_clock::now();
-		startClk = ReadTSC();
+/// <summary> Receives the result of the scrambling so that it cannot be optimized away. </summary>
+inline volatile unsigned scrambleSink;
+} // namespace impl
+
+/// <summary> Executes pseudo-random conditional and indirect branches so that the measured code
+///		cannot benefit from branch history left over from the previous pass. </summary>
+NOINLINE void ScrambleBranchHistory() {
+	using Target = unsigned (*)(unsigned);
+	static Target const volatile targets[8] = {
+		&impl::ScrambleTarget<0>,
+		&impl::ScrambleTarget<1>,
+		&impl::ScrambleTarget<2>,
+		&impl::ScrambleTarget<3>,
+		&impl::ScrambleTarget<4>,
+		&impl::ScrambleTarget<5>,
+		&impl::ScrambleTarget<6>,
+		&impl::ScrambleTarget<7>,
+	};
+
+	uint32_t state = uint32_t(ReadTSC()) | 1u;
+	unsigned acc = 0;
+	for (int i = 0; i < 8192; ++i) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		if (state & 0x10) {
+			acc += state;
+		}
+		else {
+			acc ^= state >> 3;
+		}
+		acc = targets[state & 7](acc);
+	}
+	impl::scrambleSink = acc;
+}
+
+
+/// <summary> Times <paramref name="repeat"/> executions of <paramref name="pass"/>. </summary>
+/// <remarks> In cold mode or when scrambling branches, the buffers are evicted and the branch history
+///		scrambled before each pass, and only the passes themselves are timed. </remarks>
+template <class Pass, class... Buffers>
+Timing RunPasses(const Pass& pass, size_t size, size_t repeat, const MeasureOptions& options, const Buffers&... buffers) {
+	std::chrono::nanoseconds timeTotal{ 0 };
+	uint64_t cyclesTotal = 0;
+	InterruptionCounters countersStart = ReadInterruptionCounters();
+
+	if (options.cacheMode == eCacheMode::WARM && !options.scrambleBranches) {
+		auto start = std::chrono::high_resolution_clock::now();
+		uint64_t startClk = ReadTSC();
 		for (size_t rep = 0; rep < repeat; ++rep) {
-			for (size_t i = 0; i < size; ++i) {
-				result[i] = binaryOp(lhs[i], rhs[i]);
-			}
+			pass();
 		}
-		endClk = ReadTSC();
-		end = std::chrono::high_resolution_clock::now();
+		uint64_t endClk = ReadTSC();
+		auto end = std::chrono::high_resolution_clock::now();
+		timeTotal = end - start;
+		cyclesTotal = endClk - startClk;
 	}
 	else {
-		start = std::chrono::high_resolution_clock::now();
-		startClk = ReadTSC();
 		for (size_t rep = 0; rep < repeat; ++rep) {
-			for (size_t i = 0; i < size; ++i) {
-				binaryOp(lhs[i], rhs[i]);
+			if (options.cacheMode == eCacheMode::COLD) {
+				(EvictFromCache(buffers), ...);
+#ifdef USE_CLFLUSH
+				_mm_mfence();
+#endif
 			}
+			if (options.scrambleBranches) {
+				ScrambleBranchHistory();
+			}
+
+			auto start = std::chrono::high_resolution_clock::now();
+			uint64_t startClk = ReadTSC();
+			pass();
+			uint64_t endClk = ReadTSC();
+			auto end = std::chrono::high_resolution_clock::now();
+			timeTotal += end - start;
+			cyclesTotal += endClk - startClk;
 		}
-		endClk = ReadTSC();
-		end = std::chrono::high_resolution_clock::now();
 	}
 
-	std::chrono::nanoseconds timeTotal = end - start;
-	uint64_t cyclesTotal = endClk - startClk;
+	InterruptionCounters countersEnd = ReadInterruptionCounters();
 	size_t opsTotal = size * repeat;
 
 	return Timing{ .timeTotal = timeTotal,
 				   .cyclesTotal = cyclesTotal,
 				   .timePerOpNs = double(timeTotal.count()) / double(opsTotal),
-				   .cyclesPerOp = double(cyclesTotal) / double(opsTotal) };
+				   .cyclesPerOp = double(cyclesTotal) / double(opsTotal),
+				   .contextSwitches = (countersEnd.voluntarySwitches - countersStart.voluntarySwitches)
+									  + (countersEnd.involuntarySwitches - countersStart.involuntarySwitches),
+				   .interrupts = countersEnd.interrupts - countersStart.interrupts };
+}
+
+
+constexpr size_t AccessClusterSize = 8;
+constexpr size_t AccessStride = 16;
+
+/// <summary> Fills <paramref name="indices"/> with a permutation of its own index range that follows the access pattern. </summary>
+inline void MakeAccessIndices(OperandArray<uint32_t>& indices, eAccessPattern pattern) {
+	static std::mt19937 rne(712);
+	const size_t size = indices.size();
+
+	switch (pattern) {
+		case eAccessPattern::SEQUENTIAL:
+			std::iota(indices.data(), indices.data() + size, 0u);
+			break;
+		case eAccessPattern::RANDOM:
+			std::iota(indices.data(), indices.data() + size, 0u);
+			std::shuffle(indices.data(), indices.data() + size, rne);
+			break;
+		case eAccessPattern::CLUSTERED: {
+			std::vector<uint32_t> clusters((size + AccessClusterSize - 1) / AccessClusterSize);
+			std::iota(clusters.begin(), clusters.end(), 0u);
+			std::shuffle(clusters.begin(), clusters.end(), rne);
+			size_t i = 0;
+			for (auto cluster : clusters) {
+				for (size_t j = cluster * AccessClusterSize; j < std::min(size, (cluster + 1) * AccessClusterSize); ++j) {
+					indices[i++] = uint32_t(j);
+				}
+			}
+			break;
+		}
+		case eAccessPattern::STRIDED: {
+			size_t i = 0;
+			for (size_t start = 0; start < AccessStride; ++start) {
+				for (size_t j = start; j < size; j += AccessStride) {
+					indices[i++] = uint32_t(j);
+				}
+			}
+			break;
+		}
+	}
+}
+
+
+/// <summary> Returns an empty arena of at least <paramref name="capacity"/> bytes with the requested placement. </summary>
+/// <remarks> The arena is kept across samples and only replaced when it is too small or placed differently,
+///		so mapping the memory and checking its huge page backing is not paid again for every sample. </remarks>
+OperandArena& ReuseArena(std::optional<OperandArena>& arena, size_t capacity, const OperandPlacement& placement) {
+	if (!arena || arena->Capacity() < capacity || arena->Placement() != placement) {
+		arena.reset();
+		arena.emplace(capacity, placement);
+	}
+	arena->Reset();
+	return *arena;
+}
+
+
+/// <summary> Fills in the alignment and cache line split statistics of the operand and result arrays. </summary>
+/// <remarks> The index arrays are left out, they are not what the kernel is measured on. </remarks>
+template <class... Operands>
+void RecordPlacement(Timing& timing, const OperandArray<Operands>&... operands) {
+	timing.alignment = std::min({ AddressAlignment(operands.data())... });
+	timing.lineSplitRatio = double((CountLineSplits(operands) + ...)) / double((operands.size() + ...));
+}
+
+
+template <class Lhs, class Rhs, class Result, class InitLhs, class InitRhs>
+Timing BinaryKernel(Result (*binaryOp)(const Lhs&, const Rhs&), const InitLhs& initLhs, const InitRhs& initRhs, size_t size, size_t repeat, const MeasureOptions& options, std::optional<OperandArena>& arenaStorage) {
+	const bool indexed = options.accessPattern != eAccessPattern::SEQUENTIAL;
+	const size_t indexCount = indexed ? size : 0;
+
+	size_t capacity = OperandArena::Footprint<Lhs>(size, options.placement) + OperandArena::Footprint<Rhs>(size, options.placement);
+	capacity += 2 * OperandArena::Footprint<uint32_t>(indexCount, options.placement);
+	if constexpr (!std::is_void_v<Result>) {
+		capacity += OperandArena::Footprint<Result>(size, options.placement);
+	}
+	OperandArena& arena = ReuseArena(arenaStorage, capacity, options.placement);
+
+	OperandArray<Lhs> lhs(arena, size);
+	OperandArray<Rhs> rhs(arena, size);
+	for (size_t i = 0; i < size; ++i) {
+		initLhs(lhs[i]);
+		initRhs(rhs[i]);
+	}
+
+	OperandArray<uint32_t> lhsIndices(arena, indexCount);
+	OperandArray<uint32_t> rhsIndices(arena, indexCount);
+	MakeAccessIndices(lhsIndices, options.accessPattern);
+	MakeAccessIndices(rhsIndices, options.accessPattern);
+
+	Timing timing;
+	if constexpr (!std::is_void_v<Result>) {
+		OperandArray<Result> result(arena, size);
+		auto pass = [&] {
+			if (indexed) {
+				for (size_t i = 0; i < size; ++i) {
+					result[i] = binaryOp(lhs[lhsIndices[i]], rhs[rhsIndices[i]]);
+				}
+			}
+			else {
+				for (size_t i = 0; i < size; ++i) {
+					result[i] = binaryOp(lhs[i], rhs[i]);
+				}
+			}
+		};
+		timing = RunPasses(pass, size, repeat, options, lhs, rhs, lhsIndices, rhsIndices, result);
+		RecordPlacement(timing, lhs, rhs, result);
+	}
+	else {
+		auto pass = [&] {
+			if (indexed) {
+				for (size_t i = 0; i < size; ++i) {
+					binaryOp(lhs[lhsIndices[i]], rhs[rhsIndices[i]]);
+				}
+			}
+			else {
+				for (size_t i = 0; i < size; ++i) {
+					binaryOp(lhs[i], rhs[i]);
+				}
+			}
+		};
+		timing = RunPasses(pass, size, repeat, options, lhs, rhs, lhsIndices, rhsIndices);
+		RecordPlacement(timing, lhs, rhs);
+	}
+
+	timing.pageSize = arena.PageSize();
+	return timing;
 }
 
 template <class Arg, class Result, class Init>
-Timing UnaryKernel(Result (*unaryOp)(const Arg&), const Init& init, size_t size, size_t repeat) {
-	std::vector<Arg> arg(size);
+Timing UnaryKernel(Result (*unaryOp)(const Arg&), const Init& init, size_t size, size_t repeat, const MeasureOptions& options, std::optional<OperandArena>& arenaStorage) {
+	const bool indexed = options.accessPattern != eAccessPattern::SEQUENTIAL;
+	const size_t indexCount = indexed ? size : 0;
+
+	size_t capacity = OperandArena::Footprint<Arg>(size, options.placement);
+	capacity += OperandArena::Footprint<uint32_t>(indexCount, options.placement);
+	if constexpr (!std::is_void_v<Result>) {
+		capacity += OperandArena::Footprint<Result>(size, options.placement);
+	}
+	OperandArena& arena = ReuseArena(arenaStorage, capacity, options.placement);
+
+	OperandArray<Arg> arg(arena, size);
 	for (size_t i = 0; i < size; ++i) {
 		init(arg[i]);
 	}
 
-	std::chrono::high_resolution_clock::time_point start, end;
-	uint64_t startClk, endClk;
+	OperandArray<uint32_t> argIndices(arena, indexCount);
+	MakeAccessIndices(argIndices, options.accessPattern);
 
+	Timing timing;
 	if constexpr (!std::is_void_v<Result>) {
-		std::vector<Result> result(size);
-
-		start = std::chrono::high_resolution_clock::now();
-		startClk = ReadTSC();
-		for (size_t rep = 0; rep < repeat; ++rep) {
-			for (size_t i = 0; i < size; ++i) {
-				result[i] = unaryOp(arg[i]);
+		OperandArray<Result> result(arena, size);
+		auto pass = [&] {
+			if (indexed) {
+				for (size_t i = 0; i < size; ++i) {
+					result[i] = unaryOp(arg[argIndices[i]]);
+				}
 			}
-		}
-		endClk = ReadTSC();
-		end = std::chrono::high_resolution_clock::now();
+			else {
+				for (size_t i = 0; i < size; ++i) {
+					result[i] = unaryOp(arg[i]);
+				}
+			}
+		};
+		timing = RunPasses(pass, size, repeat, options, arg, argIndices, result);
+		RecordPlacement(timing, arg, result);
 	}
 	else {
-		auto start = std::chrono::high_resolution_clock::now();
-		startClk = ReadTSC();
-		for (size_t rep = 0; rep < repeat; ++rep) {
-			for (size_t i = 0; i < size; ++i) {
-				unaryOp(arg[i]);
+		auto pass = [&] {
+			if (indexed) {
+				for (size_t i = 0; i < size; ++i) {
+					unaryOp(arg[argIndices[i]]);
+				}
 			}
-		}
-		endClk = ReadTSC();
-		end = std::chrono::high_resolution_clock::now();
+			else {
+				for (size_t i = 0; i < size; ++i) {
+					unaryOp(arg[i]);
+				}
+			}
+		};
+		timing = RunPasses(pass, size, repeat, options, arg, argIndices);
+		RecordPlacement(timing, arg);
 	}
 
-	std::chrono::nanoseconds timeTotal = end - start;
-	uint64_t cyclesTotal = endClk - startClk;
-	size_t opsTotal = size * repeat;
-
-	return Timing{ .timeTotal = timeTotal,
-				   .cyclesTotal = cyclesTotal,
-				   .timePerOpNs = double(timeTotal.count()) / double(opsTotal),
-				   .cyclesPerOp = double(cyclesTotal) / double(opsTotal) };
+	timing.pageSize = arena.PageSize();
+	return timing;
 }
 
 
 template <class Func>
-Measurement Measure(Func func) {
+Measurement Measure(Func func, const MeasureOptions& options) {
 	try {
 		using namespace std::chrono_literals;
 
+		const bool cold = options.cacheMode == eCacheMode::COLD || options.scrambleBranches;
+
 		const int initialSize = 750;
 		const int initialRep = 100;
-		int samplesDesired = 500;
+		const int warmSamples = 500;
+		// Cold passes are preceded by eviction, which costs far more than the pass itself.
+		int samplesDesired = cold ? 100 : warmSamples;
 		double timeTotalDesired = 0.10f; // 100 ms
-		double timeSampleDesired = timeTotalDesired / samplesDesired;
-		Timing initial = func(initialSize, initialRep);
+		double timeSampleDesired = timeTotalDesired / warmSamples;
+		// The size is calibrated warm, so that warm and cold runs use the same working set.
+		Timing initial = func(initialSize, initialRep, MeasureOptions{});
 		double timeInitial = std::chrono::nanoseconds(initial.timeTotal).count() / 1e9;
 		double scaling = timeSampleDesired / timeInitial;
 
-		const int size = std::min(1000, std::max(50, int(initialSize * scaling)));
-		const int rep = initialRep;
+		int size = std::min(1000, std::max(50, int(initialSize * scaling)));
+		int rep = initialRep;
+		if (options.size != 0) {
+			double timePass = timeInitial / initialRep * options.size / initialSize;
+			size = int(options.size);
+			rep = std::clamp(int(timeSampleDesired / timePass), 1, initialRep);
+			samplesDesired = std::clamp(int(timeTotalDesired / (timePass * rep)), 20, samplesDesired);
+		}
+		rep = cold ? std::min(rep, 10) : rep;
+
+		std::vector<Timing> samples;
+		for (int i = 0; i < samplesDesired; ++i) {
+			samples.push_back(func(size, rep, options));
+		}
+
+		auto isContaminated = [](const Timing& timing) {
+			return timing.contextSwitches != 0 || timing.interrupts != 0;
+		};
+		const int numContaminated = int(std::count_if(samples.begin(), samples.end(), isContaminated));
+		const bool discardContaminated = numContaminated < samplesDesired;
 
+		int samplesUsed = 0;
 		Timing sum = { 0ns, 0, 0, 0 };
-		Timing min = { 100000000000000000ns, 1000000000000000000ull, 1e20, 1e20 };
+		Timing min = { 100000000000000000ns, 1000000000000000000ull, 1e20, 1e20, CacheLineSize, 0, SIZE_MAX };
 		Timing max = { 0ns, 0, 0, 0 };
-		for (int i = 0; i < samplesDesired; ++i) {
-			Timing timing = func(size, rep);
+		for (const Timing& timing : samples) {
+			if (discardContaminated && isContaminated(timing)) {
+				continue;
+			}
+			++samplesUsed;
 
 			sum.timeTotal += timing.timeTotal;
 			sum.cyclesTotal += timing.cyclesTotal;
@@ -172,20 +476,28 @@ Measurement Measure(Func func) {
 			max.cyclesTotal = std::max(max.cyclesTotal, timing.cyclesTotal);
 			max.cyclesPerOp = std::max(max.cyclesPerOp, timing.cyclesPerOp);
 			max.timePerOpNs = std::max(max.timePerOpNs, timing.timePerOpNs);
+
+			min.alignment = std::min(min.alignment, timing.alignment);
+			min.pageSize = std::min(min.pageSize, timing.pageSize);
+			max.lineSplitRatio = std::max(max.lineSplitRatio, timing.lineSplitRatio);
 		}
 
 		Measurement meas;
 		meas.minCyclesPerOp = min.cyclesPerOp;
 		meas.maxCyclesPerOp = max.cyclesPerOp;
-		meas.avgCyclesPerOp = sum.cyclesPerOp / samplesDesired;
+		meas.avgCyclesPerOp = sum.cyclesPerOp / samplesUsed;
 
 		meas.minTimePerOpNs = min.timePerOpNs;
 		meas.maxTimePerOpNs = max.timePerOpNs;
-		meas.avgTimePerOpNs = sum.timePerOpNs / samplesDesired;
+		meas.avgTimePerOpNs = sum.timePerOpNs / samplesUsed;
 
-		meas.numTimesRun = samplesDesired;
+		meas.numTimesRun = samplesUsed;
+		meas.numContaminated = numContaminated;
 		meas.rep = rep;
 		meas.size = size;
+		meas.alignment = min.alignment;
+		meas.lineSplitRatio = max.lineSplitRatio;
+		meas.pageSize = min.pageSize;
 
 		return meas;
 	}
@@ -196,15 +508,19 @@ Measurement Measure(Func func) {
 
 
 template <class Lhs, class Rhs, class Result, class InitLhs, class InitRhs>
-Measurement MeasureBinaryKernel(Result (*binaryOp)(const Lhs&, const Rhs&), const InitLhs& initLhs, const InitRhs& initRhs) {
-	return Measure([&](size_t size, size_t reps) {
-		return BinaryKernel(binaryOp, initLhs, initRhs, size, reps);
-	});
+Measurement MeasureBinaryKernel(Result (*binaryOp)(const Lhs&, const Rhs&), const InitLhs& initLhs, const InitRhs& initRhs, const MeasureOptions& options = {}) {
+	std::optional<OperandArena> arena;
+	auto kernel = [&](size_t size, size_t reps, const MeasureOptions& runOptions) {
+		return BinaryKernel(binaryOp, initLhs, initRhs, size, reps, runOptions, arena);
+	};
+	return Measure(kernel, options);
 }
 
 template <class Arg, class Result, class Init>
-Measurement MeasureUnaryKernel(Result (*unaryOp)(const Arg&), const Init& init) {
-	return Measure([&](size_t size, size_t reps) {
-		return UnaryKernel(unaryOp, init, size, reps);
-	});
-}
\ No newline at end of file
+Measurement MeasureUnaryKernel(Result (*unaryOp)(const Arg&), const Init& init, const MeasureOptions& options = {}) {
+	std::optional<OperandArena> arena;
+	auto kernel = [&](size_t size, size_t reps, const MeasureOptions& runOptions) {
+		return UnaryKernel(unaryOp, init, size, reps, runOptions, arena);
+	};
+	return Measure(kernel, options);
+}
@@ -0,0 +1,425 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include "../Matrix/MatrixBatch.hpp"
+#include "DecomposeSVD3x3.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+
+namespace mathter {
+
+
+/// <summary> A utility class that can do common operations with the Cholesky decomposition A = L * L^T,
+///		i.e. solving symmetric positive definite equation systems. </summary>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+class DecompositionCholesky {
+	using MatrixT = Matrix<T, Dim, Dim, Order, Layout, Packed>;
+
+public:
+	/// <summary> Solves the equation system Ax=b, that is L*L^T*x=b. </summary>
+	/// <remarks> If the matrix is not positive definite, garbage is returned. </remarks>
+	/// <param name="b"> The right hand side vector. </param>
+	/// <returns> The solution x. </returns>
+	Vector<T, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const;
+
+	/// <summary> False if the matrix was not positive definite, in which case L contains NaNs. </summary>
+	bool Solvable() const {
+		for (int i = 0; i < Dim; ++i) {
+			if (!(L(i, i) > T(0))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <param name="L"> Lower triangular matrix, A = L * L^T. </param>
+	MatrixT L;
+};
+
+
+/// <summary> A utility class that can do common operations with the LDL^T decomposition A = L * D * L^T,
+///		i.e. solving symmetric equation systems. </summary>
+/// <remarks> Unlike Cholesky, it takes no square roots and works on indefinite matrices as well,
+///		as long as no pivot is zero. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+class DecompositionLDLT {
+	using MatrixT = Matrix<T, Dim, Dim, Order, Layout, Packed>;
+
+public:
+	/// <summary> Solves the equation system Ax=b, that is L*D*L^T*x=b. </summary>
+	/// <remarks> If a pivot is zero, garbage is returned. </remarks>
+	/// <param name="b"> The right hand side vector. </param>
+	/// <returns> The solution x. </returns>
+	Vector<T, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const;
+
+	bool Solvable() const {
+		for (int i = 0; i < Dim; ++i) {
+			if (!(std::abs(D(i)) > T(0))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <param name="L"> Lower triangular matrix with ones on the diagonal, A = L * D * L^T. </param>
+	MatrixT L;
+	/// <param name="D"> The diagonal of D. </param>
+	Vector<T, Dim, Packed> D;
+};
+
+
+/// <summary> The Cholesky decompositions of a pack of matrices. </summary>
+/// <remarks> The upper triangle of L is zero. </remarks>
+template <class T, int Dim, int Lanes>
+class DecompositionCholeskyBatch {
+public:
+	/// <summary> Solves the equation systems of all lanes. </summary>
+	VectorBatch<T, Dim, Lanes> Solve(const VectorBatch<T, Dim, Lanes>& b) const;
+
+	MatrixBatch<T, Dim, Dim, Lanes> L;
+	/// <summary> The reciprocals of L's diagonal, which the substitutions multiply with. </summary>
+	Simd<T, Lanes> invDiagonal[Dim];
+};
+
+
+/// <summary> The LDL^T decompositions of a pack of matrices. </summary>
+/// <remarks> L has ones on the diagonal and zeros above. </remarks>
+template <class T, int Dim, int Lanes>
+class DecompositionLDLTBatch {
+public:
+	/// <summary> Solves the equation systems of all lanes. </summary>
+	VectorBatch<T, Dim, Lanes> Solve(const VectorBatch<T, Dim, Lanes>& b) const;
+
+	MatrixBatch<T, Dim, Dim, Lanes> L;
+	Simd<T, Lanes> D[Dim];
+	/// <summary> The reciprocals of D, which the substitutions multiply with. </summary>
+	Simd<T, Lanes> invD[Dim];
+};
+
+
+namespace impl {
+	/// <summary> Overwrites the lower triangle of the symmetric a with its Cholesky factor. </summary>
+	/// <remarks> The upper triangle is not accessed. Works on scalars and <see cref="SimdLane"/>s alike. </remarks>
+	template <int Dim, class L>
+	void CholeskyFactor(L (&a)[Dim][Dim], L (&invDiagonal)[Dim]) {
+		for (int j = 0; j < Dim; ++j) {
+			L diagonal = a[j][j];
+			for (int k = 0; k < j; ++k) {
+				diagonal = diagonal - a[j][k] * a[j][k];
+			}
+			invDiagonal[j] = LaneRsqrt(diagonal);
+			a[j][j] = diagonal * invDiagonal[j];
+			for (int i = j + 1; i < Dim; ++i) {
+				L element = a[i][j];
+				for (int k = 0; k < j; ++k) {
+					element = element - a[i][k] * a[j][k];
+				}
+				a[i][j] = element * invDiagonal[j];
+			}
+		}
+	}
+
+	/// <summary> Solves L*L^T*x=b in place, x holds b on input. </summary>
+	template <int Dim, class L>
+	void CholeskySubstitute(const L (&l)[Dim][Dim], const L (&invDiagonal)[Dim], L (&x)[Dim]) {
+		for (int i = 0; i < Dim; ++i) {
+			for (int k = 0; k < i; ++k) {
+				x[i] = x[i] - l[i][k] * x[k];
+			}
+			x[i] = x[i] * invDiagonal[i];
+		}
+		for (int i = Dim - 1; i >= 0; --i) {
+			for (int k = i + 1; k < Dim; ++k) {
+				x[i] = x[i] - l[k][i] * x[k];
+			}
+			x[i] = x[i] * invDiagonal[i];
+		}
+	}
+
+	/// <summary> Overwrites the strict lower triangle of the symmetric a with L and the diagonal with D of its LDL^T decomposition. </summary>
+	/// <remarks> The upper triangle is not accessed. Works on scalars and <see cref="SimdLane"/>s alike. </remarks>
+	template <int Dim, class L>
+	void LDLTFactor(L (&a)[Dim][Dim], L (&invD)[Dim]) {
+		using T = typename LaneScalar<L>::type;
+		// The current row of L times D. Only the first j elements are used in column j, zeroing the rest
+		// lets the compiler see that nothing is read before it is written.
+		L scaled[Dim];
+		for (auto& element : scaled) {
+			element = L(T(0));
+		}
+		for (int j = 0; j < Dim; ++j) {
+			L diagonal = a[j][j];
+			for (int k = 0; k < j; ++k) {
+				scaled[k] = a[j][k] * a[k][k];
+				diagonal = diagonal - a[j][k] * scaled[k];
+			}
+			a[j][j] = diagonal;
+			invD[j] = L(T(1)) / diagonal;
+			for (int i = j + 1; i < Dim; ++i) {
+				L element = a[i][j];
+				for (int k = 0; k < j; ++k) {
+					element = element - a[i][k] * scaled[k];
+				}
+				a[i][j] = element * invD[j];
+			}
+		}
+	}
+
+	/// <summary> Solves L*D*L^T*x=b in place, x holds b on input. The diagonal of l is not accessed. </summary>
+	template <int Dim, class L>
+	void LDLTSubstitute(const L (&l)[Dim][Dim], const L (&invD)[Dim], L (&x)[Dim]) {
+		for (int i = 0; i < Dim; ++i) {
+			for (int k = 0; k < i; ++k) {
+				x[i] = x[i] - l[i][k] * x[k];
+			}
+		}
+		for (int i = 0; i < Dim; ++i) {
+			x[i] = x[i] * invD[i];
+		}
+		for (int i = Dim - 1; i >= 0; --i) {
+			for (int k = i + 1; k < Dim; ++k) {
+				x[i] = x[i] - l[k][i] * x[k];
+			}
+		}
+	}
+
+	template <int Dim, class T, int Lanes>
+	void LoadLowerTriangle(const MatrixBatch<T, Dim, Dim, Lanes>& m, SimdLane<T, Lanes> (&a)[Dim][Dim]) {
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j <= i; ++j) {
+				a[i][j] = m(i, j);
+			}
+		}
+	}
+} // namespace impl
+
+
+/// <summary> Calculates the Cholesky decomposition of a symmetric positive definite matrix. </summary>
+/// <remarks> Only the lower triangle of <paramref name="m"/> is read.
+///		Takes about half the work of <see cref="DecomposeLU"/> and needs no pivoting. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeCholesky(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
+	T a[Dim][Dim], invDiagonal[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j <= i; ++j) {
+			a[i][j] = m(i, j);
+		}
+	}
+
+	impl::CholeskyFactor(a, invDiagonal);
+
+	DecompositionCholesky<T, Dim, Order, Layout, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			result.L(i, j) = j <= i ? a[i][j] : T(0);
+		}
+	}
+	return result;
+}
+
+
+/// <summary> Calculates the LDL^T decomposition of a symmetric matrix, without pivoting. </summary>
+/// <remarks> Only the lower triangle of <paramref name="m"/> is read. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeLDLT(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
+	T a[Dim][Dim], invD[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j <= i; ++j) {
+			a[i][j] = m(i, j);
+		}
+	}
+
+	impl::LDLTFactor(a, invD);
+
+	DecompositionLDLT<T, Dim, Order, Layout, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			result.L(i, j) = j < i ? a[i][j] : T(i == j);
+		}
+		result.D(i) = a[i][i];
+	}
+	return result;
+}
+
+
+/// <summary> Calculates the Cholesky decompositions of all matrices in the pack at once. </summary>
+/// <remarks> The lanes are processed in lockstep without branches. A lane that is not positive definite
+///		yields NaNs but does not affect the others. </remarks>
+template <class T, int Dim, int Lanes>
+auto DecomposeCholesky(const MatrixBatch<T, Dim, Dim, Lanes>& m) {
+	using L = impl::SimdLane<T, Lanes>;
+	L a[Dim][Dim], invDiagonal[Dim];
+	impl::LoadLowerTriangle(m, a);
+
+	impl::CholeskyFactor(a, invDiagonal);
+
+	DecompositionCholeskyBatch<T, Dim, Lanes> result;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			result.L(i, j) = j <= i ? a[i][j].v : Simd<T, Lanes>::spread(T(0));
+		}
+		result.invDiagonal[i] = invDiagonal[i].v;
+	}
+	return result;
+}
+
+
+/// <summary> Calculates the LDL^T decompositions of all matrices in the pack at once. </summary>
+template <class T, int Dim, int Lanes>
+auto DecomposeLDLT(const MatrixBatch<T, Dim, Dim, Lanes>& m) {
+	using L = impl::SimdLane<T, Lanes>;
+	L a[Dim][Dim], invD[Dim];
+	impl::LoadLowerTriangle(m, a);
+
+	impl::LDLTFactor(a, invD);
+
+	DecompositionLDLTBatch<T, Dim, Lanes> result;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			result.L(i, j) = j < i ? a[i][j].v : Simd<T, Lanes>::spread(T(i == j));
+		}
+		result.D[i] = a[i][i].v;
+		result.invD[i] = invD[i].v;
+	}
+	return result;
+}
+
+
+/// <summary> Factorizes and solves <paramref name="count"/> packs of symmetric positive definite systems, A*x=b. </summary>
+/// <remarks> Meant for many small independent systems, such as the per-contact blocks of a constraint solver.
+///		The factors stay in registers and are never stored. <paramref name="x"/> may alias <paramref name="b"/>. </remarks>
+template <class T, int Dim, int Lanes>
+void SolveCholesky(const MatrixBatch<T, Dim, Dim, Lanes>* A, const VectorBatch<T, Dim, Lanes>* b, VectorBatch<T, Dim, Lanes>* x, size_t count) {
+	using L = impl::SimdLane<T, Lanes>;
+	for (size_t pack = 0; pack < count; ++pack) {
+		L a[Dim][Dim], invDiagonal[Dim], solution[Dim];
+		impl::LoadLowerTriangle(A[pack], a);
+		for (int i = 0; i < Dim; ++i) {
+			solution[i] = b[pack](i);
+		}
+
+		impl::CholeskyFactor(a, invDiagonal);
+		impl::CholeskySubstitute(a, invDiagonal, solution);
+
+		for (int i = 0; i < Dim; ++i) {
+			x[pack](i) = solution[i].v;
+		}
+	}
+}
+
+
+/// <summary> Factorizes and solves <paramref name="count"/> packs of symmetric systems, A*x=b, by LDL^T. </summary>
+/// <remarks> See <see cref="SolveCholesky"/>. </remarks>
+template <class T, int Dim, int Lanes>
+void SolveLDLT(const MatrixBatch<T, Dim, Dim, Lanes>* A, const VectorBatch<T, Dim, Lanes>* b, VectorBatch<T, Dim, Lanes>* x, size_t count) {
+	using L = impl::SimdLane<T, Lanes>;
+	for (size_t pack = 0; pack < count; ++pack) {
+		L a[Dim][Dim], invD[Dim], solution[Dim];
+		impl::LoadLowerTriangle(A[pack], a);
+		for (int i = 0; i < Dim; ++i) {
+			solution[i] = b[pack](i);
+		}
+
+		impl::LDLTFactor(a, invD);
+		impl::LDLTSubstitute(a, invD, solution);
+
+		for (int i = 0; i < Dim; ++i) {
+			x[pack](i) = solution[i].v;
+		}
+	}
+}
+
+
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Vector<T, Dim, Packed> DecompositionCholesky<T, Dim, Order, Layout, Packed>::Solve(const Vector<T, Dim, Packed>& b) const {
+	T l[Dim][Dim], invDiagonal[Dim], x[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j <= i; ++j) {
+			l[i][j] = L(i, j);
+		}
+		invDiagonal[i] = T(1) / l[i][i];
+		x[i] = b(i);
+	}
+
+	impl::CholeskySubstitute(l, invDiagonal, x);
+
+	Vector<T, Dim, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		result(i) = x[i];
+	}
+	return result;
+}
+
+
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Vector<T, Dim, Packed> DecompositionLDLT<T, Dim, Order, Layout, Packed>::Solve(const Vector<T, Dim, Packed>& b) const {
+	T l[Dim][Dim], invD[Dim], x[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < i; ++j) {
+			l[i][j] = L(i, j);
+		}
+		invD[i] = T(1) / D(i);
+		x[i] = b(i);
+	}
+
+	impl::LDLTSubstitute(l, invD, x);
+
+	Vector<T, Dim, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		result(i) = x[i];
+	}
+	return result;
+}
+
+
+template <class T, int Dim, int Lanes>
+VectorBatch<T, Dim, Lanes> DecompositionCholeskyBatch<T, Dim, Lanes>::Solve(const VectorBatch<T, Dim, Lanes>& b) const {
+	using Lane = impl::SimdLane<T, Lanes>;
+	Lane l[Dim][Dim], invDiagonalLanes[Dim], x[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j <= i; ++j) {
+			l[i][j] = L(i, j);
+		}
+		invDiagonalLanes[i] = invDiagonal[i];
+		x[i] = b(i);
+	}
+
+	impl::CholeskySubstitute(l, invDiagonalLanes, x);
+
+	VectorBatch<T, Dim, Lanes> result;
+	for (int i = 0; i < Dim; ++i) {
+		result(i) = x[i].v;
+	}
+	return result;
+}
+
+
+template <class T, int Dim, int Lanes>
+VectorBatch<T, Dim, Lanes> DecompositionLDLTBatch<T, Dim, Lanes>::Solve(const VectorBatch<T, Dim, Lanes>& b) const {
+	using Lane = impl::SimdLane<T, Lanes>;
+	Lane l[Dim][Dim], invDLanes[Dim], x[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < i; ++j) {
+			l[i][j] = L(i, j);
+		}
+		invDLanes[i] = invD[i];
+		x[i] = b(i);
+	}
+
+	impl::LDLTSubstitute(l, invDLanes, x);
+
+	VectorBatch<T, Dim, Lanes> result;
+	for (int i = 0; i < Dim; ++i) {
+		result(i) = x[i].v;
+	}
+	return result;
+}
+
+
+} // namespace mathter
@@ -0,0 +1,356 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include "../Matrix/MatrixImpl.hpp"
+#include "../Vector.hpp"
+#include "DecomposeSVD3x3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace mathter {
+
+
+/// <summary> The eigendecomposition of a symmetric matrix, A = vectors * diag(values) * vectors^T. </summary>
+/// <remarks> The eigenvalues are sorted in increasing order, and the columns of <see cref="vectors"/> are the
+///		corresponding unit length eigenvectors. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+class DecompositionEigenSymmetric {
+public:
+	Vector<T, Dim, Packed> values;
+	Matrix<T, Dim, Dim, Order, Layout, Packed> vectors;
+};
+
+
+/// <summary> The eigendecompositions of a pack of symmetric 3x3 matrices, laid out like <see cref="DecompositionEigenSymmetric"/>. </summary>
+template <class T, int Lanes>
+class DecompositionEigenSymmetricBatch {
+public:
+	Simd<T, Lanes> values[3];
+	MatrixBatch<T, 3, 3, Lanes> vectors;
+};
+
+
+namespace impl {
+	/// <summary> Sorts the eigenvalues in increasing order, the columns of the eigenvectors move along. </summary>
+	template <class T, int Dim>
+	void SortEigen(T (&values)[Dim], T (&vectors)[Dim][Dim]) {
+		for (int i = 0; i < Dim - 1; ++i) {
+			int smallest = i;
+			for (int j = i + 1; j < Dim; ++j) {
+				smallest = values[j] < values[smallest] ? j : smallest;
+			}
+			if (smallest != i) {
+				std::swap(values[i], values[smallest]);
+				for (int k = 0; k < Dim; ++k) {
+					std::swap(vectors[k][i], vectors[k][smallest]);
+				}
+			}
+		}
+	}
+
+
+	/// <summary> Divides a by its largest absolute element, and returns that element. </summary>
+	/// <remarks> Scaling to [-1, 1] avoids overflow and underflow when squaring the elements. </remarks>
+	template <class T, int Dim>
+	T ScaleToUnit(T (&a)[Dim][Dim]) {
+		T scale = T(0);
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j < Dim; ++j) {
+				scale = std::max(scale, std::abs(a[i][j]));
+			}
+		}
+		if (scale != T(0)) {
+			const T invScale = T(1) / scale;
+			for (int i = 0; i < Dim; ++i) {
+				for (int j = 0; j < Dim; ++j) {
+					a[i][j] *= invScale;
+				}
+			}
+		}
+		return scale;
+	}
+
+
+	/// <summary> A unit eigenvector of the symmetric a for the eigenvalue that is separated from the other two. </summary>
+	/// <remarks> a - value*I has rank 2, so the longest cross product of two of its rows is the most accurate null vector. </remarks>
+	template <class T>
+	Vector<T, 3, true> EigenSymmetric3x3Vector0(const T (&a)[3][3], T value) {
+		const Vector<T, 3, true> row0 = { a[0][0] - value, a[0][1], a[0][2] };
+		const Vector<T, 3, true> row1 = { a[1][0], a[1][1] - value, a[1][2] };
+		const Vector<T, 3, true> row2 = { a[2][0], a[2][1], a[2][2] - value };
+		const Vector<T, 3, true> r01 = Cross(row0, row1);
+		const Vector<T, 3, true> r02 = Cross(row0, row2);
+		const Vector<T, 3, true> r12 = Cross(row1, row2);
+		const T d01 = Dot(r01, r01);
+		const T d02 = Dot(r02, r02);
+		const T d12 = Dot(r12, r12);
+		if (d01 >= d02 && d01 >= d12) {
+			return r01 * (T(1) / std::sqrt(d01));
+		}
+		if (d02 >= d12) {
+			return r02 * (T(1) / std::sqrt(d02));
+		}
+		return r12 * (T(1) / std::sqrt(d12));
+	}
+
+
+	/// <summary> A unit eigenvector of the symmetric a for the middle eigenvalue, perpendicular to <paramref name="vector0"/>. </summary>
+	/// <remarks> Solves the 2x2 problem restricted to the plane perpendicular to vector0, which stays accurate
+	///		when the middle eigenvalue equals one of the others. </remarks>
+	template <class T>
+	Vector<T, 3, true> EigenSymmetric3x3Vector1(const T (&a)[3][3], const Vector<T, 3, true>& vector0, T value) {
+		// u, v and vector0 form an orthonormal basis.
+		Vector<T, 3, true> u;
+		if (std::abs(vector0[0]) > std::abs(vector0[1])) {
+			const T invLength = T(1) / std::sqrt(vector0[0] * vector0[0] + vector0[2] * vector0[2]);
+			u = { -vector0[2] * invLength, T(0), vector0[0] * invLength };
+		}
+		else {
+			const T invLength = T(1) / std::sqrt(vector0[1] * vector0[1] + vector0[2] * vector0[2]);
+			u = { T(0), vector0[2] * invLength, -vector0[1] * invLength };
+		}
+		const Vector<T, 3, true> v = Cross(vector0, u);
+
+		const Vector<T, 3, true> au = {
+			a[0][0] * u[0] + a[0][1] * u[1] + a[0][2] * u[2],
+			a[1][0] * u[0] + a[1][1] * u[1] + a[1][2] * u[2],
+			a[2][0] * u[0] + a[2][1] * u[1] + a[2][2] * u[2],
+		};
+		const Vector<T, 3, true> av = {
+			a[0][0] * v[0] + a[0][1] * v[1] + a[0][2] * v[2],
+			a[1][0] * v[0] + a[1][1] * v[1] + a[1][2] * v[2],
+			a[2][0] * v[0] + a[2][1] * v[1] + a[2][2] * v[2],
+		};
+		T m00 = Dot(u, au) - value;
+		T m01 = Dot(u, av);
+		T m11 = Dot(v, av) - value;
+
+		// The null vector of [m00, m01; m01, m11] from its longer row, as coefficients of u and v.
+		const bool useFirstRow = std::abs(m00) >= std::abs(m11);
+		const T x = useFirstRow ? m00 : m01;
+		const T y = useFirstRow ? m01 : m11;
+		const T length = std::sqrt(x * x + y * y);
+		if (length == T(0)) {
+			// Every vector of the plane is an eigenvector.
+			return u;
+		}
+		return (y * u - x * v) * (T(1) / length);
+	}
+
+
+	/// <summary> Eigendecomposition of a symmetric 3x3 matrix from the roots of its characteristic polynomial, after
+	///		D. Eberly, "A Robust Eigensolver for 3x3 Symmetric Matrices". </summary>
+	/// <remarks> The eigenvalues are sorted in increasing order. </remarks>
+	template <class T>
+	void EigenSymmetric3x3(T (&a)[3][3], T (&values)[3], T (&vectors)[3][3]) {
+		if (a[0][1] == T(0) && a[0][2] == T(0) && a[1][2] == T(0)) {
+			for (int i = 0; i < 3; ++i) {
+				values[i] = a[i][i];
+				for (int j = 0; j < 3; ++j) {
+					vectors[i][j] = T(i == j);
+				}
+			}
+			SortEigen(values, vectors);
+			return;
+		}
+		const T scale = ScaleToUnit(a);
+		const T offDiagonal = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+
+		// The eigenvalues are q + 2p*cos(angle + 2k*pi/3), where the angle comes from the determinant of (A - qI)/p.
+		const T q = (a[0][0] + a[1][1] + a[2][2]) / T(3);
+		const T b00 = a[0][0] - q, b11 = a[1][1] - q, b22 = a[2][2] - q;
+		const T p = std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + T(2) * offDiagonal) / T(6));
+		const T c00 = b11 * b22 - a[1][2] * a[1][2];
+		const T c01 = a[0][1] * b22 - a[1][2] * a[0][2];
+		const T c02 = a[0][1] * a[1][2] - b11 * a[0][2];
+		const T halfDet = std::clamp((b00 * c00 - a[0][1] * c01 + a[0][2] * c02) / (T(2) * p * p * p), T(-1), T(1));
+		const T angle = std::acos(halfDet) / T(3);
+		const T cosAngle = std::cos(angle);
+		const T sinAngle = std::sin(angle);
+		const T sqrt3 = T(1.73205080756887729);
+		const T beta2 = T(2) * cosAngle;
+		const T beta0 = -cosAngle - sqrt3 * sinAngle; // 2*cos(angle + 2pi/3)
+		const T beta1 = -(beta0 + beta2);
+		values[0] = q + p * beta0;
+		values[1] = q + p * beta1;
+		values[2] = q + p * beta2;
+
+		// Start from the eigenvalue that is farther from the middle one.
+		Vector<T, 3, true> e0, e1, e2;
+		if (halfDet >= T(0)) {
+			e2 = EigenSymmetric3x3Vector0(a, values[2]);
+			e1 = EigenSymmetric3x3Vector1(a, e2, values[1]);
+			e0 = Cross(e1, e2);
+		}
+		else {
+			e0 = EigenSymmetric3x3Vector0(a, values[0]);
+			e1 = EigenSymmetric3x3Vector1(a, e0, values[1]);
+			e2 = Cross(e0, e1);
+		}
+		for (int i = 0; i < 3; ++i) {
+			values[i] *= scale;
+			vectors[i][0] = e0[i];
+			vectors[i][1] = e1[i];
+			vectors[i][2] = e2[i];
+		}
+	}
+
+
+	/// <summary> Eigendecomposition of a symmetric matrix by cyclic Jacobi rotations. </summary>
+	/// <remarks> Sweeps until the off-diagonal elements are negligible. The eigenvalues are sorted in increasing order. </remarks>
+	template <class T, int Dim>
+	void EigenSymmetricJacobi(T (&a)[Dim][Dim], T (&values)[Dim], T (&vectors)[Dim][Dim]) {
+		constexpr int maxSweeps = 16;
+		const T epsilon = std::numeric_limits<T>::epsilon();
+
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j < Dim; ++j) {
+				vectors[i][j] = T(i == j);
+			}
+		}
+
+		const T scale = ScaleToUnit(a);
+		T normSquared = T(0);
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j < Dim; ++j) {
+				normSquared += a[i][j] * a[i][j];
+			}
+		}
+
+		for (int sweep = 0; sweep < maxSweeps; ++sweep) {
+			T offDiagonal = T(0);
+			for (int p = 0; p < Dim; ++p) {
+				for (int q = p + 1; q < Dim; ++q) {
+					offDiagonal += a[p][q] * a[p][q];
+				}
+			}
+			if (offDiagonal <= epsilon * epsilon * normSquared) {
+				break;
+			}
+
+			for (int p = 0; p < Dim; ++p) {
+				for (int q = p + 1; q < Dim; ++q) {
+					if (a[p][q] == T(0)) {
+						continue;
+					}
+
+					// The rotation that zeroes a[p][q], using the smaller of the two solutions for the tangent.
+					const T theta = (a[q][q] - a[p][p]) / (T(2) * a[p][q]);
+					const T t = std::copysign(T(1), theta) / (std::abs(theta) + std::sqrt(theta * theta + T(1)));
+					const T c = T(1) / std::sqrt(t * t + T(1));
+					const T s = t * c;
+
+					for (int k = 0; k < Dim; ++k) {
+						const T akp = a[k][p], akq = a[k][q];
+						a[k][p] = c * akp - s * akq;
+						a[k][q] = s * akp + c * akq;
+					}
+					for (int k = 0; k < Dim; ++k) {
+						const T apk = a[p][k], aqk = a[q][k];
+						a[p][k] = c * apk - s * aqk;
+						a[q][k] = s * apk + c * aqk;
+					}
+					for (int k = 0; k < Dim; ++k) {
+						const T vkp = vectors[k][p], vkq = vectors[k][q];
+						vectors[k][p] = c * vkp - s * vkq;
+						vectors[k][q] = s * vkp + c * vkq;
+					}
+				}
+			}
+		}
+
+		for (int i = 0; i < Dim; ++i) {
+			values[i] = a[i][i] * scale;
+		}
+		SortEigen(values, vectors);
+	}
+} // namespace impl
+
+
+/// <summary> Calculates the eigenvalues and eigenvectors of a symmetric matrix. </summary>
+/// <remarks> Only the upper triangle of <paramref name="m"/> is read.
+///		3x3 matrices are solved analytically. In float, that is accurate to about 1e-5 relative to the largest eigenvalue,
+///		but only to about 1e-3 when two eigenvalues nearly coincide, since their angle is found by acos.
+///		Other sizes use Jacobi rotations and are meant for small matrices. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeEigenSymmetric(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
+	T a[Dim][Dim], values[Dim], vectors[Dim][Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = i; j < Dim; ++j) {
+			a[i][j] = a[j][i] = m(i, j);
+		}
+	}
+
+	if constexpr (Dim == 3) {
+		impl::EigenSymmetric3x3(a, values, vectors);
+	}
+	else {
+		impl::EigenSymmetricJacobi(a, values, vectors);
+	}
+
+	DecompositionEigenSymmetric<T, Dim, Order, Layout, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		result.values[i] = values[i];
+		for (int j = 0; j < Dim; ++j) {
+			result.vectors(i, j) = vectors[i][j];
+		}
+	}
+	return result;
+}
+
+
+/// <summary> Calculates the eigenvalues and eigenvectors of each symmetric matrix in the pack. </summary>
+/// <remarks> Uses a fixed number of approximate Jacobi rotations without branching, like <see cref="DecomposeSVD3x3"/>,
+///		instead of the analytic solution of the single matrix overload. Accurate to about 1e-5 relative to the largest
+///		eigenvalue in float, even for coinciding eigenvalues. Only the upper triangle is read. </remarks>
+template <class T, int Lanes>
+auto DecomposeEigenSymmetric(const MatrixBatch<T, 3, 3, Lanes>& m) {
+	using L = impl::SimdLane<T, Lanes>;
+	L s11 = m(0, 0), s21 = m(0, 1), s22 = m(1, 1), s31 = m(0, 2), s32 = m(1, 2), s33 = m(2, 2);
+
+	// Scale each matrix to [-1, 1] like the single matrix overload, zero matrices are left alone.
+	L scale = impl::LaneMax(impl::LaneMax(impl::LaneAbs(s11), impl::LaneAbs(s22)), impl::LaneAbs(s33));
+	scale = impl::LaneMax(impl::LaneMax(impl::LaneMax(scale, impl::LaneAbs(s21)), impl::LaneAbs(s31)), impl::LaneAbs(s32));
+	scale = impl::LaneSelect(impl::LaneLess(L(T(0)), scale), scale, L(T(1)));
+	const L invScale = Simd<T, Lanes>::div(Simd<T, Lanes>::spread(T(1)), scale.v);
+	s11 = s11 * invScale;
+	s21 = s21 * invScale;
+	s22 = s22 * invScale;
+	s31 = s31 * invScale;
+	s32 = s32 * invScale;
+	s33 = s33 * invScale;
+
+	L v[3][3];
+	impl::Svd3x3JacobiEigen(s11, s21, s22, s31, s32, s33, v);
+
+	// Sort by increasing eigenvalue, negating one of the swapped columns keeps v a rotation.
+	L values[3] = { s11 * scale, s22 * scale, s33 * scale };
+	constexpr int pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+	for (const auto& pair : pairs) {
+		const int j = pair[0], k = pair[1];
+		const auto swap = impl::LaneLess(values[k], values[j]);
+		for (int i = 0; i < 3; ++i) {
+			impl::LaneNegSwap(swap, v[i][j], v[i][k]);
+		}
+		impl::LaneSwap(swap, values[j], values[k]);
+	}
+
+	DecompositionEigenSymmetricBatch<T, Lanes> result;
+	for (int i = 0; i < 3; ++i) {
+		result.values[i] = values[i].v;
+		for (int j = 0; j < 3; ++j) {
+			result.vectors(i, j) = v[i][j].v;
+		}
+	}
+	return result;
+}
+
+
+} // namespace mathter
@@ -7,6 +7,9 @@
 
 #include "../Common/Range.hpp"
 
+#include <cmath>
+#include <utility>
+
 
 namespace mathter {
 
@@ -21,7 +24,7 @@ class DecompositionLU {
 	friend class DecompositionLUP;
 
 private:
-	static Vector<float, Dim, Packed> Solve(const MatrixT& L, const MatrixT& U, const Vector<T, Dim, Packed>& b);
+	static Vector<T, Dim, Packed> Solve(const MatrixT& L, const MatrixT& U, const Vector<T, Dim, Packed>& b);
 
 public:
 	//DecompositionLU(MatrixT L, MatrixT U) : L(L), U(U) {}
@@ -30,7 +33,7 @@ public:
 	/// <remarks> If the equation is singular or the LU decomposition fails, garbage is returned. </remarks>
 	/// <param name="b"> The right hand side vector. </summary>
 	/// <returns> The solution x. </returns>
-	Vector<float, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const {
+	Vector<T, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const {
 		return Solve(L, U, b);
 	}
 
@@ -65,7 +68,7 @@ public:
 	/// <remarks> If the equation is singular garbage is returned. </remarks>
 	/// <param name="b"> The right hand side vector. </param>
 	/// <returns> The solution x. </returns>
-	Vector<float, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const;
+	Vector<T, Dim, Packed> Solve(const Vector<T, Dim, Packed>& b) const;
 
 	bool Solvable() {
 		T prod = L(0, 0);
@@ -87,6 +90,40 @@ public:
 };
 
 
+namespace impl {
+	/// <summary> The row type of Gaussian elimination on Dim x Dim matrices. </summary>
+	/// <remarks> Float rows of 5 to 7 elements are padded to 8, so that each row operation is a few SIMD instructions. </remarks>
+	template <class T, int Dim>
+	using EliminationRow = Vector<T, (Dim >= 5 && Dim < 8 && traits::HasSimd<Vector<T, 8, false>>::value) ? 8 : Dim, false>;
+
+	/// <summary> Copies the rows of m into rows and zeros the padding. </summary>
+	template <class Row, class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+	void LoadRows(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m, Row (&rows)[Dim]) {
+		for (int i = 0; i < Dim; ++i) {
+			rows[i] = Row(T(0));
+			for (int j = 0; j < Dim; ++j) {
+				rows[i](j) = m(i, j);
+			}
+		}
+	}
+
+	/// <summary> The row at or below <paramref name="column"/> whose element in that column has the largest magnitude. </summary>
+	template <class Row, int Dim>
+	int PivotRow(const Row (&rows)[Dim], int column) {
+		int largest = column;
+		auto p = std::abs(rows[column](column));
+		for (int i = column + 1; i < Dim; ++i) {
+			const auto candidate = std::abs(rows[i](column));
+			if (candidate > p) {
+				largest = i;
+				p = candidate;
+			}
+		}
+		return largest;
+	}
+} // namespace impl
+
+
 template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 auto DecomposeLU(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
 	// From: https://www.gamedev.net/resources/_/technical/math-and-physics/matrix-inversion-using-lu-decomposition-r3637
@@ -115,7 +152,7 @@ auto DecomposeLU(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
 
 	for (int j = 1; j < n - 1; ++j) {
 		for (int i = j; i < n; ++i) {
-			float Lij;
+			T Lij;
 			Lij = A(i, j);
 			for (int k = 0; k <= j - 1; ++k) {
 				Lij -= L(i, k) * U(k, j);
@@ -123,7 +160,7 @@ auto DecomposeLU(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
 			L(i, j) = Lij;
 		}
 		for (int k = j; k < n; ++k) {
-			float Ujk;
+			T Ujk;
 			Ujk = A(j, k);
 			for (int i = 0; i <= j - 1; ++i) {
 				Ujk -= L(j, i) * U(i, k);
@@ -152,7 +189,6 @@ auto DecomposeLUP(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m, int& pari
 	Matrix<T, Dim, Dim, Order, Layout, Packed> L;
 	Matrix<T, Dim, Dim, Order, Layout, Packed> U;
 	Vector<int, Dim, false> P;
-	U = m;
 
 	int n = m.RowCount();
 	parity = 1;
@@ -161,6 +197,52 @@ auto DecomposeLUP(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m, int& pari
 		P(i) = i;
 	}
 
+	if constexpr (Dim >= 5) {
+		// Eliminate with whole rows at once, see impl::EliminationRow.
+		using Row = impl::EliminationRow<T, Dim>;
+		Row rows[Dim];
+		T multipliers[Dim][Dim];
+		impl::LoadRows(m, rows);
+
+		for (int j = 0; j < Dim; ++j) {
+			const int largest = impl::PivotRow(rows, j);
+
+			// The column is already eliminated, like in the element-wise path.
+			if (rows[largest](j) == T(0)) {
+				for (int i = j + 1; i < Dim; ++i) {
+					multipliers[i][j] = T(0);
+				}
+				continue;
+			}
+
+			if (largest != j) {
+				std::swap(rows[j], rows[largest]);
+				std::swap(P(j), P(largest));
+				for (int k = 0; k < j; ++k) {
+					std::swap(multipliers[j][k], multipliers[largest][k]);
+				}
+				parity = -parity;
+			}
+
+			const T invPivot = T(1) / rows[j](j);
+			for (int i = j + 1; i < Dim; ++i) {
+				const T multiplier = rows[i](j) * invPivot;
+				rows[i] -= rows[j] * multiplier;
+				multipliers[i][j] = multiplier;
+			}
+		}
+
+		// The rows' elements below the diagonal are rounding residue, L gets the multipliers instead.
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j < Dim; ++j) {
+				L(i, j) = j < i ? multipliers[i][j] : T(i == j);
+				U(i, j) = j < i ? T(0) : rows[i](j);
+			}
+		}
+		return DecompositionLUP<T, Dim, Order, Layout, Packed>{ L, U, P };
+	}
+
+	U = m;
 	for (int j : Range(0, n)) {
 		// find largest pivot elements
 		T p = 0;
@@ -219,43 +301,45 @@ auto DecomposeLUP(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
 
 
 template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-Vector<float, Dim, Packed> DecompositionLU<T, Dim, Order, Layout, Packed>::Solve(const MatrixT& L, const MatrixT& U, const Vector<T, Dim, Packed>& b) {
-	// Matrix to do gaussian elimination with
-	Matrix<T, Dim, Dim + 1, eMatrixOrder::FOLLOW_VECTOR, eMatrixLayout::ROW_MAJOR, Packed> E;
-
-	// Solve Ld = b;
-	E.template Submatrix<Dim, Dim>(0, 0) = L;
-	E.Column(Dim) = b;
-
-	for (int i = 0; i < Dim - 1; ++i) {
-		for (int i2 = i + 1; i2 < Dim; ++i2) {
-			E.stripes[i] /= E(i, i);
-			T coeff = E(i2, i);
-			E.stripes[i2] -= E.stripes[i] * coeff;
-		}
+Vector<T, Dim, Packed> DecompositionLU<T, Dim, Order, Layout, Packed>::Solve(const MatrixT& L, const MatrixT& U, const Vector<T, Dim, Packed>& b) {
+	// Neither diagonal is assumed to be ones, so this works for both Crout's LU and the LUP.
+	// The reciprocals are independent of each other, which keeps the divisions off the substitutions' dependency chain.
+	T x[Dim], invL[Dim], invU[Dim];
+	for (int i = 0; i < Dim; ++i) {
+		invL[i] = T(1) / L(i, i);
+		invU[i] = T(1) / U(i, i);
 	}
-	E(Dim - 1, Dim) /= E(Dim - 1, Dim - 1);
-	// d is now the last column of E
 
-	// Solve Ux = d
-	E.template Submatrix<Dim, Dim>(0, 0) = U;
+	// Solve Ld = b by forward substitution.
+	// Each solved element is eliminated from all remaining ones, and these updates are independent.
+	for (int i = 0; i < Dim; ++i) {
+		x[i] = b(i);
+	}
+	for (int k = 0; k < Dim; ++k) {
+		x[k] *= invL[k];
+		for (int i = k + 1; i < Dim; ++i) {
+			x[i] -= L(i, k) * x[k];
+		}
+	}
 
-	for (int i = Dim - 1; i > 0; --i) {
-		for (int i2 = i - 1; i2 >= 0; --i2) {
-			E.stripes[i] /= E(i, i);
-			T coeff = E(i2, i);
-			E.stripes[i2] -= E.stripes[i] * coeff;
+	// Solve Ux = d by back substitution.
+	for (int k = Dim - 1; k >= 0; --k) {
+		x[k] *= invU[k];
+		for (int i = 0; i < k; ++i) {
+			x[i] -= U(i, k) * x[k];
 		}
 	}
-	E(0, Dim) /= E(0, 0);
-	// x is now the last column of E
 
-	return E.Column(Dim);
+	Vector<T, Dim, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		result(i) = x[i];
+	}
+	return result;
 }
 
 
 template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-Vector<float, Dim, Packed> DecompositionLUP<T, Dim, Order, Layout, Packed>::Solve(const Vector<T, Dim, Packed>& b) const {
+Vector<T, Dim, Packed> DecompositionLUP<T, Dim, Order, Layout, Packed>::Solve(const Vector<T, Dim, Packed>& b) const {
 	// Permute b
 	Vector<T, Dim, Packed> bp;
 	for (int i : Range(0, P.Dimension())) {
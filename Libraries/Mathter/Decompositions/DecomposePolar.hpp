@@ -0,0 +1,143 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include "../Matrix/MatrixFunction.hpp"
+
+#include <cmath>
+#include <limits>
+
+
+namespace mathter {
+
+
+/// <summary> The polar decomposition of a square matrix, A = R * S. </summary>
+/// <remarks> R is orthogonal and S is symmetric positive definite. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+class DecompositionPolar {
+	using MatrixT = Matrix<T, Dim, Dim, Order, Layout, Packed>;
+
+public:
+	MatrixT R;
+	MatrixT S;
+};
+
+
+namespace impl {
+	/// <summary> Writes the transpose of the inverse of x into result. </summary>
+	template <class T, int Dim>
+	void InverseTranspose(const T (&x)[Dim][Dim], T (&result)[Dim][Dim]) {
+		if constexpr (Dim == 3) {
+			// The inverse transpose is the cofactor matrix over the determinant.
+			for (int i = 0; i < 3; ++i) {
+				const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+				for (int j = 0; j < 3; ++j) {
+					const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+					result[i][j] = x[i1][j1] * x[i2][j2] - x[i1][j2] * x[i2][j1];
+				}
+			}
+			const T invDet = T(1) / (x[0][0] * result[0][0] + x[0][1] * result[0][1] + x[0][2] * result[0][2]);
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					result[i][j] *= invDet;
+				}
+			}
+		}
+		else {
+			Matrix<T, Dim, Dim> m;
+			for (int i = 0; i < Dim; ++i) {
+				for (int j = 0; j < Dim; ++j) {
+					m(i, j) = x[i][j];
+				}
+			}
+			const auto inverse = Inverse(m);
+			for (int i = 0; i < Dim; ++i) {
+				for (int j = 0; j < Dim; ++j) {
+					result[i][j] = inverse(j, i);
+				}
+			}
+		}
+	}
+} // namespace impl
+
+
+/// <summary> Calculates the polar decomposition of an invertible matrix by N. Higham's scaled Newton iteration. </summary>
+/// <remarks> Much cheaper than <see cref="DecomposeSVD"/> when only the rotation is needed, as the iteration
+///		typically converges in 3 to 6 steps, each taking one inverse.
+///		R is a rotation if det(m) is positive, and a reflection if it's negative. </remarks>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposePolar(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
+	constexpr int maxIterations = 20;
+	// The iteration converges quadratically, so once a step is smaller than sqrt(epsilon), the next one is at epsilon.
+	const T tolerance = std::numeric_limits<T>::epsilon();
+	// Scaling speeds up the first steps but ruins quadratic convergence near the end.
+	const T scalingThreshold = T(1e-4);
+
+	T x[Dim][Dim], inverseTranspose[Dim][Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			x[i][j] = m(i, j);
+		}
+	}
+
+	bool scaling = true;
+	for (int iteration = 0; iteration < maxIterations; ++iteration) {
+		impl::InverseTranspose(x, inverseTranspose);
+
+		T zeta = T(1);
+		if (scaling) {
+			T normSquared = T(0), inverseNormSquared = T(0);
+			for (int i = 0; i < Dim; ++i) {
+				for (int j = 0; j < Dim; ++j) {
+					normSquared += x[i][j] * x[i][j];
+					inverseNormSquared += inverseTranspose[i][j] * inverseTranspose[i][j];
+				}
+			}
+			zeta = std::sqrt(std::sqrt(inverseNormSquared / normSquared));
+		}
+
+		const T weight = T(0.5) * zeta;
+		const T inverseWeight = T(0.5) / zeta;
+		T changeSquared = T(0), nextSquared = T(0);
+		for (int i = 0; i < Dim; ++i) {
+			for (int j = 0; j < Dim; ++j) {
+				const T next = weight * x[i][j] + inverseWeight * inverseTranspose[i][j];
+				changeSquared += (next - x[i][j]) * (next - x[i][j]);
+				nextSquared += next * next;
+				x[i][j] = next;
+			}
+		}
+
+		const T change = changeSquared / nextSquared;
+		if (change <= tolerance) {
+			break;
+		}
+		scaling = change > scalingThreshold;
+	}
+
+	// S = R^T * A, symmetrized to remove rounding errors.
+	T s[Dim][Dim];
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			s[i][j] = T(0);
+			for (int k = 0; k < Dim; ++k) {
+				s[i][j] += x[k][i] * m(k, j);
+			}
+		}
+	}
+
+	DecompositionPolar<T, Dim, Order, Layout, Packed> result;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			result.R(i, j) = x[i][j];
+			result.S(i, j) = T(0.5) * (s[i][j] + s[j][i]);
+		}
+	}
+	return result;
+}
+
+
+} // namespace mathter
@@ -9,6 +9,8 @@
 #include "../Transforms/ZeroBuilder.hpp"
 #include "../Transforms/IdentityBuilder.hpp"
 
+#include <cmath>
+
 
 namespace mathter {
 
@@ -28,45 +30,203 @@ public:
 };
 
 
-/// <summary> Calculates the QR decomposition of the matrix using Householder transforms. </summary>
-/// <remarks> The matrix must have Rows &lt;= Columns. It's a full QR decomposition, not a thin one. </remarks>
+/// <summary> The QR decomposition of a matrix with Q kept as a sequence of Householder reflections. </summary>
+/// <remarks> Q = H_0 * H_1 * ... * H_(Columns-1), where H_j = I - 2 v_j v_j^T and v_j is the j-th column of reflectors.
+///		Applying Q this way takes O(Rows*Columns) operations instead of forming the Rows x Rows matrix. </remarks>
 template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-auto DecomposeQR(Matrix<T, Rows, Columns, Order, Layout, Packed> m) {
-	static_assert(Rows >= Columns);
+class DecompositionQRImplicit {
+public:
+	/// <summary> Returns Q * v. </summary>
+	Vector<T, Rows, Packed> ApplyQ(const Vector<T, Rows, Packed>& v) const;
 
-	Matrix<T, Rows, Rows, Order, Layout, Packed> Q;
+	/// <summary> Returns Q^T * v. </summary>
+	Vector<T, Rows, Packed> ApplyQTranspose(const Vector<T, Rows, Packed>& v) const;
+
+	/// <summary> Forms Q explicitly. </summary>
+	Matrix<T, Rows, Rows, Order, Layout, Packed> Q() const;
+
+	/// <summary> Solves the equation system Ax=b in the least squares sense, that is, minimizes |Ax-b|. </summary>
+	/// <remarks> For square matrices, this is the exact solution. If A does not have full column rank, garbage is returned. </remarks>
+	/// <param name="b"> The right hand side vector. </param>
+	/// <returns> The solution x. </returns>
+	Vector<T, Columns, Packed> Solve(const Vector<T, Rows, Packed>& b) const;
+
+	/// <param name="R"> Upper triangular matrix, A = QR. </param>
 	Matrix<T, Rows, Columns, Order, Layout, Packed> R;
+	/// <param name="reflectors"> The unit normals of the Householder reflections, in columns.
+	///		A zero column stands for the identity. </param>
+	Matrix<T, Rows, Columns, Order, Layout, Packed> reflectors;
+
+private:
+	/// <summary> Applies the reflections to the columns of x in the order of Q^T, or Q if <paramref name="reverse"/> is set. </summary>
+	template <int Count>
+	void Reflect(T (&x)[Count][Rows], bool reverse) const;
+};
+
 
-	R = m;
-	Q = Identity();
+/// <summary> Calculates the QR decomposition of the matrix using Householder transforms, without forming Q. </summary>
+/// <remarks> The matrix must have Rows &gt;= Columns. Works on a plain column-major copy of the matrix,
+///		the fixed length loops over columns are vectorized by the compiler. </remarks>
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeQRImplicit(const Matrix<T, Rows, Columns, Order, Layout, Packed>& m) {
+	static_assert(Rows >= Columns);
 
-	Matrix<T, Rows, Rows, Order, Layout, Packed> Qi;
-	Vector<T, Rows, Packed> u;
-	Matrix<T, Rows, 1, Order, eMatrixLayout::ROW_MAJOR, Packed> v;
+	T a[Columns][Rows];
+	for (int j = 0; j < Columns; ++j) {
+		for (int i = 0; i < Rows; ++i) {
+			a[j][i] = m(i, j);
+		}
+	}
 
-	for (int col = 0; col < m.ColumnCount(); ++col) {
-		u = R.Column(col);
-		for (int i = 0; i < col; ++i) {
-			u(i) = T(0);
+	DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed> result;
+	for (int col = 0; col < Columns; ++col) {
+		T normSquared = T(0);
+		for (int i = col; i < Rows; ++i) {
+			normSquared += a[col][i] * a[col][i];
 		}
-		T alpha = sign(R(col, col)) * LengthPrecise(u);
-		u(col) -= alpha;
-		T norm = LengthPrecise(u);
-		if (norm == 0) {
-			continue;
+		const T x = a[col][col];
+		const T norm = std::sqrt(normSquared);
+		const T alpha = x >= T(0) ? -norm : norm;
+		const T vNormSquared = T(2) * norm * (norm + std::abs(x));
+		const T tau = vNormSquared > T(0) ? T(2) / vNormSquared : T(0);
+		a[col][col] = x - alpha;
+
+		for (int c = col + 1; c < Columns; ++c) {
+			T dot = T(0);
+			for (int i = col; i < Rows; ++i) {
+				dot += a[col][i] * a[c][i];
+			}
+			dot *= tau;
+			for (int i = col; i < Rows; ++i) {
+				a[c][i] -= a[col][i] * dot;
+			}
 		}
-		u /= norm;
-		v = u;
-		Qi = (T(-2) * v) * Transpose(v);
-		for (int i = 0; i < Q.ColumnCount(); ++i) {
-			Qi(i, i) += T(1);
+
+		const T scale = std::sqrt(T(0.5) * tau);
+		for (int i = 0; i < Rows; ++i) {
+			result.reflectors(i, col) = i < col ? T(0) : a[col][i] * scale;
+			result.R(i, col) = i < col ? a[col][i] : T(0);
 		}
-		R = Qi * R;
-		Q = Qi * Q;
+		result.R(col, col) = vNormSquared > T(0) ? alpha : x;
 	}
-	Q = Transpose(Q);
 
-	return DecompositionQR<T, Rows, Columns, Order, Layout, Packed>{ Q, R };
+	return result;
+}
+
+
+/// <summary> Calculates the QR decomposition of the matrix using Householder transforms. </summary>
+/// <remarks> The matrix must have Rows &gt;= Columns. It's a full QR decomposition, not a thin one.
+///		Use <see cref="DecomposeQRImplicit"/> if Q is only needed to multiply with. </remarks>
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeQR(const Matrix<T, Rows, Columns, Order, Layout, Packed>& m) {
+	const auto qr = DecomposeQRImplicit(m);
+	return DecompositionQR<T, Rows, Columns, Order, Layout, Packed>{ qr.Q(), qr.R };
+}
+
+
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+template <int Count>
+void DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed>::Reflect(T (&x)[Count][Rows], bool reverse) const {
+	for (int step = 0; step < Columns; ++step) {
+		const int col = reverse ? Columns - 1 - step : step;
+		// The reflector is zero above the diagonal.
+		T v[Rows];
+		for (int i = col; i < Rows; ++i) {
+			v[i] = reflectors(i, col);
+		}
+		for (int c = 0; c < Count; ++c) {
+			T dot = T(0);
+			for (int i = col; i < Rows; ++i) {
+				dot += v[i] * x[c][i];
+			}
+			dot *= T(2);
+			for (int i = col; i < Rows; ++i) {
+				x[c][i] -= v[i] * dot;
+			}
+		}
+	}
+}
+
+
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Vector<T, Rows, Packed> DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed>::ApplyQ(const Vector<T, Rows, Packed>& v) const {
+	T x[1][Rows];
+	for (int i = 0; i < Rows; ++i) {
+		x[0][i] = v(i);
+	}
+	Reflect(x, true);
+
+	Vector<T, Rows, Packed> result;
+	for (int i = 0; i < Rows; ++i) {
+		result(i) = x[0][i];
+	}
+	return result;
+}
+
+
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Vector<T, Rows, Packed> DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed>::ApplyQTranspose(const Vector<T, Rows, Packed>& v) const {
+	T x[1][Rows];
+	for (int i = 0; i < Rows; ++i) {
+		x[0][i] = v(i);
+	}
+	Reflect(x, false);
+
+	Vector<T, Rows, Packed> result;
+	for (int i = 0; i < Rows; ++i) {
+		result(i) = x[0][i];
+	}
+	return result;
+}
+
+
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Matrix<T, Rows, Rows, Order, Layout, Packed> DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed>::Q() const {
+	// Reflect the columns of the identity.
+	T q[Rows][Rows];
+	for (int j = 0; j < Rows; ++j) {
+		for (int i = 0; i < Rows; ++i) {
+			q[j][i] = T(i == j);
+		}
+	}
+	Reflect(q, true);
+
+	Matrix<T, Rows, Rows, Order, Layout, Packed> result;
+	for (int i = 0; i < Rows; ++i) {
+		for (int j = 0; j < Rows; ++j) {
+			result(i, j) = q[j][i];
+		}
+	}
+	return result;
+}
+
+
+template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Vector<T, Columns, Packed> DecompositionQRImplicit<T, Rows, Columns, Order, Layout, Packed>::Solve(const Vector<T, Rows, Packed>& b) const {
+	T y[1][Rows];
+	for (int i = 0; i < Rows; ++i) {
+		y[0][i] = b(i);
+	}
+	Reflect(y, false);
+
+	// Solve the top of Rx = Q^T b by back substitution, the rest of the rows are the residual.
+	T x[Columns], invDiagonal[Columns];
+	for (int i = 0; i < Columns; ++i) {
+		x[i] = y[0][i];
+		invDiagonal[i] = T(1) / R(i, i);
+	}
+	for (int k = Columns - 1; k >= 0; --k) {
+		x[k] *= invDiagonal[k];
+		for (int i = 0; i < k; ++i) {
+			x[i] -= R(i, k) * x[k];
+		}
+	}
+
+	Vector<T, Columns, Packed> result;
+	for (int i = 0; i < Columns; ++i) {
+		result(i) = x[i];
+	}
+	return result;
 }
 
 
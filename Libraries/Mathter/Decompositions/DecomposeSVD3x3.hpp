@@ -0,0 +1,339 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include "../Matrix/MatrixBatch.hpp"
+#include "DecomposeSVD.hpp"
+
+#include <cmath>
+
+
+namespace mathter {
+
+
+/// <summary> The singular value decomposition of a pack of 3x3 matrices, laid out like <see cref="DecompositionSVD"/>. </summary>
+/// <remarks> The off-diagonal elements of S are zero. </remarks>
+template <class T, int Lanes>
+class DecompositionSVDBatch {
+public:
+	MatrixBatch<T, 3, 3, Lanes> U;
+	MatrixBatch<T, 3, 3, Lanes> S;
+	MatrixBatch<T, 3, 3, Lanes> V;
+};
+
+
+namespace impl {
+	/// <summary> Wraps a Simd pack into a value with arithmetic operators, so that the same code runs on scalars and packs. </summary>
+	template <class T, int Lanes>
+	struct SimdLane {
+		using SimdT = Simd<T, Lanes>;
+		SimdT v;
+
+		SimdLane() {}
+		SimdLane(const SimdT& v) : v(v) {}
+		SimdLane(T scalar) : v(SimdT::spread(scalar)) {}
+
+		friend SimdLane operator+(const SimdLane& lhs, const SimdLane& rhs) { return SimdT::add(lhs.v, rhs.v); }
+		friend SimdLane operator-(const SimdLane& lhs, const SimdLane& rhs) { return SimdT::sub(lhs.v, rhs.v); }
+		friend SimdLane operator*(const SimdLane& lhs, const SimdLane& rhs) { return SimdT::mul(lhs.v, rhs.v); }
+		friend SimdLane operator/(const SimdLane& lhs, const SimdLane& rhs) { return SimdT::div(lhs.v, rhs.v); }
+		friend SimdLane operator-(const SimdLane& arg) { return SimdT::sub(SimdT::spread(T(0)), arg.v); }
+	};
+
+	template <class L>
+	struct LaneScalar {
+		using type = L;
+	};
+	template <class T, int Lanes>
+	struct LaneScalar<SimdLane<T, Lanes>> {
+		using type = T;
+	};
+
+	// Lane-wise functions. Masks are bools for scalars and all-bits-set lanes for packs.
+	template <class T>
+	T LaneSqrt(T arg) { return std::sqrt(arg); }
+	template <class T>
+	T LaneRsqrt(T arg) { return T(1) / std::sqrt(arg); }
+	template <class T>
+	T LaneAbs(T arg) { return std::abs(arg); }
+	template <class T>
+	T LaneMax(T lhs, T rhs) { return std::max(lhs, rhs); }
+	template <class T>
+	bool LaneLess(T lhs, T rhs) { return lhs < rhs; }
+	template <class T>
+	T LaneSelect(bool mask, T ifTrue, T ifFalse) { return mask ? ifTrue : ifFalse; }
+
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneSqrt(const SimdLane<T, Lanes>& arg) { return Simd<T, Lanes>::sqrt(arg.v); }
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneRsqrt(const SimdLane<T, Lanes>& arg) { return Simd<T, Lanes>::div(Simd<T, Lanes>::spread(T(1)), Simd<T, Lanes>::sqrt(arg.v)); }
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneAbs(const SimdLane<T, Lanes>& arg) { return Simd<T, Lanes>::abs(arg.v); }
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneMax(const SimdLane<T, Lanes>& lhs, const SimdLane<T, Lanes>& rhs) { return Simd<T, Lanes>::max(lhs.v, rhs.v); }
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneLess(const SimdLane<T, Lanes>& lhs, const SimdLane<T, Lanes>& rhs) { return Simd<T, Lanes>::less(lhs.v, rhs.v); }
+	template <class T, int Lanes>
+	SimdLane<T, Lanes> LaneSelect(const SimdLane<T, Lanes>& mask, const SimdLane<T, Lanes>& ifTrue, const SimdLane<T, Lanes>& ifFalse) {
+		return Simd<T, Lanes>::select(mask.v, ifTrue.v, ifFalse.v);
+	}
+
+	template <class L, class Mask>
+	void LaneSwap(const Mask& mask, L& x, L& y) {
+		L tmp = x;
+		x = LaneSelect(mask, y, x);
+		y = LaneSelect(mask, tmp, y);
+	}
+
+	/// <summary> Swaps x and y where the mask is set, and negates the new y, which keeps the determinant when swapping columns. </summary>
+	template <class L, class Mask>
+	void LaneNegSwap(const Mask& mask, L& x, L& y) {
+		L tmp = -x;
+		x = LaneSelect(mask, y, x);
+		y = LaneSelect(mask, tmp, y);
+	}
+
+
+	/// <summary> The quaternion (ch, sh) of a rotation that approximately annihilates a12 of the symmetric [a11, a12; a12, a22]. </summary>
+	/// <remarks> Falls back to a rotation by pi/4 when the half angle formula would rotate too little to converge. </remarks>
+	template <class L>
+	void Svd3x3ApproximateGivens(const L& a11, const L& a12, const L& a22, L& ch, L& sh) {
+		using T = typename LaneScalar<L>::type;
+		const T gamma = T(5.82842712474619); // 3 + 2*sqrt(2)
+		const T cosPi8 = T(0.923879532511287);
+		const T sinPi8 = T(0.382683432365090);
+
+		ch = T(2) * (a11 - a22);
+		sh = a12;
+		const auto useHalfAngle = LaneLess(gamma * sh * sh, ch * ch);
+		const L invLength = LaneRsqrt(ch * ch + sh * sh);
+		ch = LaneSelect(useHalfAngle, invLength * ch, L(cosPi8));
+		sh = LaneSelect(useHalfAngle, invLength * sh, L(sinPi8));
+	}
+
+
+	/// <summary> One Jacobi step on the (0, 1) block of the symmetric s, accumulated into the quaternion q = (x, y, z, w). </summary>
+	/// <remarks> s is then cyclically permuted so that the next call works on the next block.
+	///		X, Y, Z track where the original axes are after the permutations. </remarks>
+	template <int X, int Y, int Z, class L>
+	void Svd3x3JacobiConjugation(L& s11, L& s21, L& s22, L& s31, L& s32, L& s33, L (&q)[4]) {
+		using T = typename LaneScalar<L>::type;
+
+		L ch, sh;
+		Svd3x3ApproximateGivens(s11, s21, s22, ch, sh);
+
+		// (ch, sh) is a unit quaternion, so these are the cosine and sine of the full angle.
+		const L a = ch * ch - sh * sh;
+		const L b = T(2) * sh * ch;
+
+		// S = Q^T * S * Q, followed by the permutation.
+		const L t11 = s11, t21 = s21, t22 = s22, t31 = s31, t32 = s32, t33 = s33;
+		s11 = -b * (-b * t11 + a * t21) + a * (-b * t21 + a * t22);
+		s21 = a * t32 - b * t31;
+		s22 = t33;
+		s31 = a * (-b * t11 + a * t21) + b * (-b * t21 + a * t22);
+		s32 = a * t31 + b * t32;
+		s33 = a * (a * t11 + b * t21) + b * (a * t21 + b * t22);
+
+		// q = q * (ch + sh*axis), where the axis is the one the block rotates around.
+		const L qx = q[X] * sh, qy = q[Y] * sh, qz = q[Z] * sh, qw = q[3] * sh;
+		q[0] = q[0] * ch;
+		q[1] = q[1] * ch;
+		q[2] = q[2] * ch;
+		q[3] = q[3] * ch;
+		q[Z] = q[Z] + qw;
+		q[3] = q[3] - qz;
+		q[X] = q[X] + qy;
+		q[Y] = q[Y] - qx;
+	}
+
+
+	/// <summary> The quaternion (ch, sh) of a Givens rotation that zeroes a2 below the pivot a1. </summary>
+	template <class L>
+	void Svd3x3QRGivens(const L& a1, const L& a2, L& ch, L& sh) {
+		using T = typename LaneScalar<L>::type;
+		const T epsilon = T(1e-6);
+
+		const L rho = LaneSqrt(a1 * a1 + a2 * a2);
+		sh = LaneSelect(LaneLess(L(epsilon), rho), a2, L(T(0)));
+		ch = LaneAbs(a1) + LaneMax(rho, L(epsilon));
+		LaneSwap(LaneLess(a1, L(T(0))), ch, sh);
+		const L invLength = LaneRsqrt(ch * ch + sh * sh);
+		ch = ch * invLength;
+		sh = sh * invLength;
+	}
+
+
+	/// <summary> Diagonalizes the symmetric s by Jacobi conjugations with a fixed number of sweeps. </summary>
+	/// <remarks> On return, s11, s22 and s33 are the eigenvalues, unsorted, and the columns of the rotation v are the eigenvectors.
+	///		The off-diagonal elements are left close to zero. </remarks>
+	template <class L>
+	void Svd3x3JacobiEigen(L& s11, L& s21, L& s22, L& s31, L& s32, L& s33, L (&v)[3][3]) {
+		using T = typename LaneScalar<L>::type;
+
+		// The paper uses 4 sweeps, but that leaves errors up to 1e-2 in about 1% of random matrices.
+		constexpr int numSweeps = 5;
+		L q[4] = { L(T(0)), L(T(0)), L(T(0)), L(T(1)) };
+		for (int sweep = 0; sweep < numSweeps; ++sweep) {
+			Svd3x3JacobiConjugation<0, 1, 2>(s11, s21, s22, s31, s32, s33, q);
+			Svd3x3JacobiConjugation<1, 2, 0>(s11, s21, s22, s31, s32, s33, q);
+			Svd3x3JacobiConjugation<2, 0, 1>(s11, s21, s22, s31, s32, s33, q);
+		}
+
+		const L invLength = LaneRsqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		const L x = q[0] * invLength, y = q[1] * invLength, z = q[2] * invLength, w = q[3] * invLength;
+		v[0][0] = T(1) - T(2) * (y * y + z * z);
+		v[0][1] = T(2) * (x * y - w * z);
+		v[0][2] = T(2) * (x * z + w * y);
+		v[1][0] = T(2) * (x * y + w * z);
+		v[1][1] = T(1) - T(2) * (x * x + z * z);
+		v[1][2] = T(2) * (y * z - w * x);
+		v[2][0] = T(2) * (x * z - w * y);
+		v[2][1] = T(2) * (y * z + w * x);
+		v[2][2] = T(1) - T(2) * (x * x + y * y);
+	}
+
+
+	/// <summary> Branch-free SVD of a 3x3 matrix with a fixed number of iterations, after A. McAdams et al.,
+	///		"Computing the Singular Value Decomposition of 3x3 matrices with minimal branching and elementary floating point operations". </summary>
+	/// <remarks> a = u * diag(s) * v^T, where u and v are rotations and s is sorted by decreasing magnitude.
+	///		Only the last singular value may be negative, which happens when det(a) is negative. </remarks>
+	template <class L>
+	void Svd3x3(const L (&a)[3][3], L (&u)[3][3], L (&s)[3], L (&v)[3][3]) {
+		using T = typename LaneScalar<L>::type;
+
+		// Eigenvectors of A^T*A are the right singular vectors.
+		L s11 = a[0][0] * a[0][0] + a[1][0] * a[1][0] + a[2][0] * a[2][0];
+		L s21 = a[0][1] * a[0][0] + a[1][1] * a[1][0] + a[2][1] * a[2][0];
+		L s22 = a[0][1] * a[0][1] + a[1][1] * a[1][1] + a[2][1] * a[2][1];
+		L s31 = a[0][2] * a[0][0] + a[1][2] * a[1][0] + a[2][2] * a[2][0];
+		L s32 = a[0][2] * a[0][1] + a[1][2] * a[1][1] + a[2][2] * a[2][1];
+		L s33 = a[0][2] * a[0][2] + a[1][2] * a[1][2] + a[2][2] * a[2][2];
+		Svd3x3JacobiEigen(s11, s21, s22, s31, s32, s33, v);
+
+		// B = A*V has orthogonal columns, their norms are the singular values.
+		L b[3][3];
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				b[i][j] = a[i][0] * v[0][j] + a[i][1] * v[1][j] + a[i][2] * v[2][j];
+			}
+		}
+
+		// Sort the columns by decreasing norm.
+		L rho[3];
+		for (int j = 0; j < 3; ++j) {
+			rho[j] = b[0][j] * b[0][j] + b[1][j] * b[1][j] + b[2][j] * b[2][j];
+		}
+		constexpr int pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+		for (const auto& pair : pairs) {
+			const int j = pair[0], k = pair[1];
+			const auto swap = LaneLess(rho[j], rho[k]);
+			for (int i = 0; i < 3; ++i) {
+				LaneNegSwap(swap, b[i][j], b[i][k]);
+				LaneNegSwap(swap, v[i][j], v[i][k]);
+			}
+			LaneSwap(swap, rho[j], rho[k]);
+		}
+
+		// QR decomposition of B by Givens rotations, Q = U and R = diag(s).
+		L ch1, sh1, ch2, sh2, ch3, sh3;
+		L r[3][3];
+
+		Svd3x3QRGivens(b[0][0], b[1][0], ch1, sh1);
+		L ca = T(1) - T(2) * sh1 * sh1;
+		L sa = T(2) * ch1 * sh1;
+		for (int j = 0; j < 3; ++j) {
+			r[0][j] = ca * b[0][j] + sa * b[1][j];
+			r[1][j] = ca * b[1][j] - sa * b[0][j];
+			r[2][j] = b[2][j];
+		}
+
+		Svd3x3QRGivens(r[0][0], r[2][0], ch2, sh2);
+		ca = T(1) - T(2) * sh2 * sh2;
+		sa = T(2) * ch2 * sh2;
+		for (int j = 0; j < 3; ++j) {
+			b[0][j] = ca * r[0][j] + sa * r[2][j];
+			b[1][j] = r[1][j];
+			b[2][j] = ca * r[2][j] - sa * r[0][j];
+		}
+
+		Svd3x3QRGivens(b[1][1], b[2][1], ch3, sh3);
+		ca = T(1) - T(2) * sh3 * sh3;
+		sa = T(2) * ch3 * sh3;
+		s[0] = b[0][0];
+		s[1] = ca * b[1][1] + sa * b[2][1];
+		s[2] = ca * b[2][2] - sa * b[1][2];
+
+		// U = Q1 * Q2 * Q3, written out.
+		const L sh1sq = sh1 * sh1, sh2sq = sh2 * sh2, sh3sq = sh3 * sh3;
+		const L c1 = T(2) * sh1sq - T(1), c2 = T(2) * sh2sq - T(1), c3 = T(2) * sh3sq - T(1);
+		u[0][0] = c1 * c2;
+		u[0][1] = T(4) * ch2 * ch3 * c1 * sh2 * sh3 + T(2) * ch1 * sh1 * c3;
+		u[0][2] = T(4) * ch1 * ch3 * sh1 * sh3 - T(2) * ch2 * c1 * sh2 * c3;
+		u[1][0] = -T(2) * ch1 * sh1 * c2;
+		u[1][1] = -T(8) * ch1 * ch2 * ch3 * sh1 * sh2 * sh3 + c1 * c3;
+		u[1][2] = -T(2) * ch3 * sh3 + T(4) * sh1 * (ch3 * sh1 * sh3 + ch1 * ch2 * sh2 * c3);
+		u[2][0] = T(2) * ch2 * sh2;
+		u[2][1] = -T(2) * ch3 * c2 * sh3;
+		u[2][2] = c2 * c3;
+	}
+} // namespace impl
+
+
+/// <summary> Calculates the SVD of a 3x3 matrix in a fixed number of steps without branching. </summary>
+/// <remarks> Much faster than <see cref="DecomposeSVD"/>. In float, U*S*V is off by about 1e-5 relative to the largest singular value,
+///		and by up to about 1e-3 for singular matrices.
+///		U and V are rotations, and the singular values are sorted by decreasing magnitude.
+///		The last singular value is negative for matrices with negative determinant. </remarks>
+template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+auto DecomposeSVD3x3(const Matrix<T, 3, 3, Order, Layout, Packed>& m) {
+	T a[3][3], u[3][3], s[3], v[3][3];
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			a[i][j] = m(i, j);
+		}
+	}
+
+	impl::Svd3x3(a, u, s, v);
+
+	DecompositionSVD<T, 3, 3, Order, Layout, Packed> result;
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			result.U(i, j) = u[i][j];
+			result.S(i, j) = i == j ? s[i] : T(0);
+			result.V(i, j) = v[j][i];
+		}
+	}
+	return result;
+}
+
+
+/// <summary> Calculates the SVD of each matrix in the pack, see the single matrix overload. </summary>
+template <class T, int Lanes>
+auto DecomposeSVD3x3(const MatrixBatch<T, 3, 3, Lanes>& m) {
+	using L = impl::SimdLane<T, Lanes>;
+	L a[3][3], u[3][3], s[3], v[3][3];
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			a[i][j] = m(i, j);
+		}
+	}
+
+	impl::Svd3x3(a, u, s, v);
+
+	DecompositionSVDBatch<T, Lanes> result;
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			result.U(i, j) = u[i][j].v;
+			result.S(i, j) = i == j ? s[i].v : Simd<T, Lanes>::spread(T(0));
+			result.V(i, j) = v[j][i].v;
+		}
+	}
+	return result;
+}
+
+
+} // namespace mathter
@@ -10,10 +10,15 @@
 #include "Matrix/MatrixArithmetic.hpp"
 #include "Matrix/MatrixVectorArithmetic.hpp"
 #include "Matrix/MatrixCompare.hpp"
+#include "Matrix/MatrixBatch.hpp"
 
 #include "Decompositions/DecomposeLU.hpp"
 #include "Decompositions/DecomposeQR.hpp"
 #include "Decompositions/DecomposeSVD.hpp"
+#include "Decompositions/DecomposeSVD3x3.hpp"
+#include "Decompositions/DecomposeEigenSymmetric.hpp"
+#include "Decompositions/DecomposePolar.hpp"
+#include "Decompositions/DecomposeCholesky.hpp"
 
 #include "Transforms/OrthographicBuilder.hpp"
 #include "Transforms/PerspectiveBuilder.hpp"
@@ -46,29 +46,134 @@ namespace impl {
 		using ResultT = Matrix<V, Rows1, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed>;
 		return ResultT{ ResultT::FromStripes, SmallProductRowCC(lhs, rhs, ColIndices, std::make_integer_sequence<int, Match>{})... };
 	}
+
+	/// <summary> Computes a TileRows x (TileSimds * SIMD width) block of a matrix product, keeping the block in registers. </summary>
+	/// <remarks> Row r of the block is the sum over k of scalars(r, k) * vectors(k). Strides are in elements. </remarks>
+	template <class SimdT, int TileRows, int TileSimds, int Match, class T>
+	inline void ProductTile(const T* scalars, int scalarRowStride, int scalarMatchStride,
+							const T* vectors, int vectorStride,
+							T* result, int resultStride) {
+		constexpr int Width = int(sizeof(SimdT) / sizeof(T));
+
+		SimdT accumulators[TileRows][TileSimds];
+		for (int r = 0; r < TileRows; ++r) {
+			for (int s = 0; s < TileSimds; ++s) {
+				accumulators[r][s] = SimdT::spread(T(0));
+			}
+		}
+		for (int k = 0; k < Match; ++k) {
+			SimdT vector[TileSimds];
+			for (int s = 0; s < TileSimds; ++s) {
+				vector[s] = SimdT::load(vectors + k * vectorStride + s * Width);
+			}
+			for (int r = 0; r < TileRows; ++r) {
+				const SimdT scalar = SimdT::spread(scalars[r * scalarRowStride + k * scalarMatchStride]);
+				for (int s = 0; s < TileSimds; ++s) {
+					accumulators[r][s] = SimdT::mad(vector[s], scalar, accumulators[r][s]);
+				}
+			}
+		}
+		for (int r = 0; r < TileRows; ++r) {
+			for (int s = 0; s < TileSimds; ++s) {
+				SimdT::store(result + r * resultStride + s * Width, accumulators[r][s]);
+			}
+		}
+	}
+
+	/// <summary> Computes the product columns [first, first + Width*TileSimds) of all rows. </summary>
+	template <class SimdT, int TileSimds, int Rows, int Match, class T>
+	inline void ProductTileColumn(const T* scalars, int scalarRowStride, int scalarMatchStride,
+								  const T* vectors, int vectorStride,
+								  T* result, int resultStride,
+								  int first) {
+		constexpr int TileRows = 4;
+		constexpr int TiledRows = Rows - Rows % TileRows;
+		for (int row = 0; row < TiledRows; row += TileRows) {
+			ProductTile<SimdT, TileRows, TileSimds, Match>(scalars + row * scalarRowStride, scalarRowStride, scalarMatchStride,
+														   vectors + first, vectorStride,
+														   result + row * resultStride + first, resultStride);
+		}
+		if constexpr (TiledRows != Rows) {
+			for (int row = TiledRows; row < Rows; ++row) {
+				ProductTile<SimdT, 1, TileSimds, Match>(scalars + row * scalarRowStride, scalarRowStride, scalarMatchStride,
+														vectors + first, vectorStride,
+														result + row * resultStride + first, resultStride);
+			}
+		}
+	}
+
+	/// <summary> Register-tiled product for large float matrices, result(r, c) = sum_k scalars(r, k) * vectors(k, c). </summary>
+	/// <remarks> The stripes of the matrices longer than 4 or 8 elements are not SIMD vectors,
+	///		so the generic stripe loop falls back to scalar code. This walks the product in 4 x 16 tiles of
+	///		Simd&lt;float, 8&gt; accumulators instead, with narrower tiles for the leftover columns.
+	///		Even 32x32 operands fit in L1, so there is no cache blocking on top. </remarks>
+	template <int Rows, int Match, int Columns, class T>
+	inline void TiledProduct(const T* scalars, int scalarRowStride, int scalarMatchStride,
+							 const T* vectors, int vectorStride,
+							 T* result, int resultStride) {
+		using Simd8 = Simd<T, 8>;
+		using Simd4 = Simd<T, 4>;
+
+		int col = 0;
+		for (; col + 16 <= Columns; col += 16) {
+			ProductTileColumn<Simd8, 2, Rows, Match>(scalars, scalarRowStride, scalarMatchStride, vectors, vectorStride, result, resultStride, col);
+		}
+		for (; col + 8 <= Columns; col += 8) {
+			ProductTileColumn<Simd8, 1, Rows, Match>(scalars, scalarRowStride, scalarMatchStride, vectors, vectorStride, result, resultStride, col);
+		}
+		for (; col + 4 <= Columns; col += 4) {
+			ProductTileColumn<Simd4, 1, Rows, Match>(scalars, scalarRowStride, scalarMatchStride, vectors, vectorStride, result, resultStride, col);
+		}
+		for (; col < Columns; ++col) {
+			for (int row = 0; row < Rows; ++row) {
+				T sum = T(0);
+				for (int k = 0; k < Match; ++k) {
+					sum += scalars[row * scalarRowStride + k * scalarMatchStride] * vectors[k * vectorStride + col];
+				}
+				result[row * resultStride + col] = sum;
+			}
+		}
+	}
+
+	template <class T, class U, int Rows1, int Match, int Columns2>
+	constexpr bool UseTiledProduct = std::is_same_v<T, float> && std::is_same_v<U, float> && Rows1 >= 8 && Columns2 >= 8;
+
+	/// <summary> The distance between consecutive stripes in elements. </summary>
+	template <class MatrixT>
+	constexpr int StripeStride = int(sizeof(std::declval<MatrixT>().stripes[0]) / sizeof(std::declval<MatrixT>().stripes[0].data[0]));
+
+	/// <summary> The product of two row-major 2x2 matrices held in single registers. </summary>
+	/// <remarks> Row i of the result is lhs(i, 0) * rhs.stripes[0] + lhs(i, 1) * rhs.stripes[1], both rows at once. </remarks>
+	template <class SimdT>
+	inline SimdT SingleRegisterProduct(const SimdT& lhs, const SimdT& rhs) {
+		const SimdT lhs0 = SimdT::template shuffle<2, 2, 0, 0>(lhs);
+		const SimdT lhs1 = SimdT::template shuffle<3, 3, 1, 1>(lhs);
+		const SimdT rhs0 = SimdT::template shuffle<1, 0, 1, 0>(rhs);
+		const SimdT rhs1 = SimdT::template shuffle<3, 2, 3, 2>(rhs);
+		return SimdT::mad(lhs0, rhs0, SimdT::mul(lhs1, rhs1));
+	}
 } // namespace impl
 
 
 template <class T, class U, int Rows1, int Match, int Columns2, eMatrixOrder Order, bool Packed>
 inline auto operator*(const Matrix<T, Rows1, Match, Order, eMatrixLayout::ROW_MAJOR, Packed>& lhs,
 					  const Matrix<U, Match, Columns2, Order, eMatrixLayout::ROW_MAJOR, Packed>& rhs) {
-#ifdef MATHTER_SSE2_HACK
-	if constexpr (Rows1 == 2 && Match == 2 && Columns2 == 2 && std::is_same_v<T, float> && std::is_same_v<U, float>) {
-		using V = traits::MatMulElemT<T, U>;
-		using Vec4T = Vector<V, 4>;
-		Vec4T lhsv;
-		Vec4T rhsv;
-		lhsv.simd.reg = _mm_loadu_ps(reinterpret_cast<const float*>(&lhs));
-		rhsv.simd.reg = _mm_loadu_ps(reinterpret_cast<const float*>(&rhs));
-		Vec4T resultv = Vec4T(lhsv.xxzz) * Vec4T(rhsv.xyxy) + Vec4T(lhsv.yyww) * Vec4T(rhsv.zwzw);
-		Matrix<V, 2, 2, Order, eMatrixLayout::ROW_MAJOR, Packed> result;
-		_mm_storeu_ps(reinterpret_cast<float*>(&result), resultv.simd.reg);
+	if constexpr (impl::IsSingleRegister<T, Rows1, Match, Packed> && impl::IsSingleRegister<U, Match, Columns2, Packed>) {
+		Matrix<float, 2, 2, Order, eMatrixLayout::ROW_MAJOR, Packed> result;
+		result.simd = impl::SingleRegisterProduct(lhs.simd, rhs.simd);
 		return result;
 	}
-#endif
-	if constexpr (Rows1 <= 4 && Match <= 4 && Columns2 <= 4) {
+	else if constexpr (Rows1 <= 4 && Match <= 4 && Columns2 <= 4) {
 		return impl::SmallProductRR(lhs, rhs, std::make_integer_sequence<int, Rows1>{});
 	}
+	else if constexpr (impl::UseTiledProduct<T, U, Rows1, Match, Columns2>) {
+		using ResultT = Matrix<float, Rows1, Columns2, Order, eMatrixLayout::ROW_MAJOR, Packed>;
+		ResultT result;
+		impl::TiledProduct<Rows1, Match, Columns2>(lhs.stripes[0].data, impl::StripeStride<std::decay_t<decltype(lhs)>>, 1,
+												   rhs.stripes[0].data, impl::StripeStride<std::decay_t<decltype(rhs)>>,
+												   result.stripes[0].data, impl::StripeStride<ResultT>);
+		return result;
+	}
 	else {
 		using V = traits::MatMulElemT<T, U>;
 		Matrix<V, Rows1, Columns2, Order, eMatrixLayout::ROW_MAJOR, Packed> result;
@@ -84,27 +189,55 @@ inline auto operator*(const Matrix<T, Rows1, Match, Order, eMatrixLayout::ROW_MA
 	}
 }
 
-template <class T, class U, int Rows1, int Match, int Columns2, eMatrixOrder Order1, eMatrixOrder Order2, bool Packed, class V>
+template <class T, class U, int Rows1, int Match, int Columns2, eMatrixOrder Order1, eMatrixOrder Order2, bool Packed>
 inline auto operator*(const Matrix<T, Rows1, Match, Order1, eMatrixLayout::ROW_MAJOR, Packed>& lhs,
-					  const Matrix<U, Match, Columns2, Order2, eMatrixLayout::COLUMN_MAJOR, Packed>& rhs)
-	-> Matrix<V, Rows1, Columns2, Order1, eMatrixLayout::ROW_MAJOR, Packed> {
-	Matrix<V, Rows1, Columns2, Order1, eMatrixLayout::ROW_MAJOR, Packed> result;
-
-	for (int j = 0; j < Columns2; ++j) {
-		for (int i = 0; i < Rows1; ++i) {
-			result(i, j) = Dot(lhs.stripes[i], rhs.stripes[j]);
+					  const Matrix<U, Match, Columns2, Order2, eMatrixLayout::COLUMN_MAJOR, Packed>& rhs) {
+	using V = traits::MatMulElemT<T, U>;
+	if constexpr (impl::UseTiledProduct<T, U, Rows1, Match, Columns2>) {
+		// Neither operand is contiguous along the columns of the result, which the tiles load as vectors.
+		// Copying rhs to row-major is quadratic against the cubic product.
+		Matrix<U, Match, Columns2, Order1, eMatrixLayout::ROW_MAJOR, Packed> rowMajorRhs;
+		for (int i = 0; i < Match; ++i) {
+			for (int j = 0; j < Columns2; ++j) {
+				rowMajorRhs(i, j) = rhs(i, j);
+			}
 		}
+		return lhs * rowMajorRhs;
 	}
+	else {
+		Matrix<V, Rows1, Columns2, Order1, eMatrixLayout::ROW_MAJOR, Packed> result;
 
-	return result;
+		for (int j = 0; j < Columns2; ++j) {
+			for (int i = 0; i < Rows1; ++i) {
+				result(i, j) = Dot(lhs.stripes[i], rhs.stripes[j]);
+			}
+		}
+
+		return result;
+	}
 }
 
 template <class T, class U, int Rows1, int Match, int Columns2, eMatrixOrder Order, bool Packed>
 inline auto operator*(const Matrix<T, Rows1, Match, Order, eMatrixLayout::COLUMN_MAJOR, Packed>& lhs,
 					  const Matrix<U, Match, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed>& rhs) {
-	if constexpr (Rows1 <= 4 && Match <= 4 && Columns2 <= 4) {
+	if constexpr (impl::IsSingleRegister<T, Rows1, Match, Packed> && impl::IsSingleRegister<U, Match, Columns2, Packed>) {
+		// Column-major storage is the row-major storage of the transpose, and (AB)^T = B^T A^T.
+		Matrix<float, 2, 2, Order, eMatrixLayout::COLUMN_MAJOR, Packed> result;
+		result.simd = impl::SingleRegisterProduct(rhs.simd, lhs.simd);
+		return result;
+	}
+	else if constexpr (Rows1 <= 4 && Match <= 4 && Columns2 <= 4) {
 		return impl::SmallProductCC(lhs, rhs, std::make_integer_sequence<int, Columns2>{});
 	}
+	else if constexpr (impl::UseTiledProduct<T, U, Rows1, Match, Columns2>) {
+		// The columns of the result are rows of the transposed product.
+		using ResultT = Matrix<float, Rows1, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed>;
+		ResultT result;
+		impl::TiledProduct<Columns2, Match, Rows1>(rhs.stripes[0].data, impl::StripeStride<std::decay_t<decltype(rhs)>>, 1,
+												   lhs.stripes[0].data, impl::StripeStride<std::decay_t<decltype(lhs)>>,
+												   result.stripes[0].data, impl::StripeStride<ResultT>);
+		return result;
+	}
 	else {
 		using V = traits::MatMulElemT<T, U>;
 		Matrix<V, Rows1, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed> result;
@@ -128,6 +261,15 @@ inline auto operator*(const Matrix<T, Rows1, Match, Order, eMatrixLayout::COLUMN
 	if constexpr (Rows1 <= 4 && Match <= 4 && Columns2 <= 4) {
 		return impl::SmallProductCC(lhs, rhs, std::make_integer_sequence<int, Columns2>{});
 	}
+	else if constexpr (impl::UseTiledProduct<T, U, Rows1, Match, Columns2>) {
+		// The columns of the result are rows of the transposed product.
+		using ResultT = Matrix<float, Rows1, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed>;
+		ResultT result;
+		impl::TiledProduct<Columns2, Match, Rows1>(rhs.stripes[0].data, 1, impl::StripeStride<std::decay_t<decltype(rhs)>>,
+												   lhs.stripes[0].data, impl::StripeStride<std::decay_t<decltype(lhs)>>,
+												   result.stripes[0].data, impl::StripeStride<ResultT>);
+		return result;
+	}
 	else {
 		using V = traits::MatMulElemT<T, U>;
 		Matrix<V, Rows1, Columns2, Order, eMatrixLayout::COLUMN_MAJOR, Packed> result;
@@ -181,7 +323,12 @@ inline auto operator+(const Matrix<T, Rows, Columns, Order, SameLayout, Packed>&
 					  const Matrix<U, Rows, Columns, Order, SameLayout, Packed>& rhs) {
 	using V = traits::MatMulElemT<T, U>;
 
-	if constexpr (Rows * Columns == 4) {
+	if constexpr (impl::IsSingleRegister<T, Rows, Columns, Packed> && impl::IsSingleRegister<U, Rows, Columns, Packed>) {
+		Matrix<float, Rows, Columns, Order, SameLayout, Packed> result;
+		result.simd = decltype(result.simd)::add(lhs.simd, rhs.simd);
+		return result;
+	}
+	else if constexpr (Rows * Columns == 4) {
 		Matrix<V, Rows, Columns, Order, SameLayout, Packed> result;
 		for (int i = 0; i < result.RowCount(); ++i) {
 			for (int j = 0; j < result.ColumnCount(); ++j) {
@@ -208,7 +355,12 @@ inline auto operator-(const Matrix<T, Rows, Columns, Order, SameLayout, Packed>&
 	using VectorAccelerator = Vector<T, 4, false>;
 	using V = traits::MatMulElemT<T, U>;
 
-	if constexpr (Rows * Columns == 4) {
+	if constexpr (impl::IsSingleRegister<T, Rows, Columns, Packed> && impl::IsSingleRegister<U, Rows, Columns, Packed>) {
+		Matrix<float, Rows, Columns, Order, SameLayout, Packed> result;
+		result.simd = decltype(result.simd)::sub(lhs.simd, rhs.simd);
+		return result;
+	}
+	else if constexpr (Rows * Columns == 4) {
 		Matrix<V, Rows, Columns, Order, SameLayout, Packed> result;
 		for (int i = 0; i < result.RowCount(); ++i) {
 			for (int j = 0; j < result.ColumnCount(); ++j) {
@@ -231,7 +383,7 @@ inline auto operator-(const Matrix<T, Rows, Columns, Order, SameLayout, Packed>&
 
 
 // Add & sub opposite layout
-template <class T, class U, int Rows, int Columns, eMatrixOrder Order1, eMatrixOrder Order2, eMatrixLayout Layout1, eMatrixLayout Layout2, bool Packed, class V, class = typename std::enable_if<Layout1 != Layout2>::type>
+template <class T, class U, int Rows, int Columns, eMatrixOrder Order1, eMatrixOrder Order2, eMatrixLayout Layout1, eMatrixLayout Layout2, bool Packed, class = typename std::enable_if<Layout1 != Layout2>::type>
 inline auto operator+(const Matrix<T, Rows, Columns, Order1, Layout1, Packed>& lhs,
 					  const Matrix<U, Rows, Columns, Order2, Layout2, Packed>& rhs) {
 	using V = traits::MatMulElemT<T, U>;
@@ -244,7 +396,7 @@ inline auto operator+(const Matrix<T, Rows, Columns, Order1, Layout1, Packed>& l
 	return result;
 }
 
-template <class T, class U, int Rows, int Columns, eMatrixOrder Order1, eMatrixOrder Order2, eMatrixLayout Layout1, eMatrixLayout Layout2, bool Packed, class V, class = typename std::enable_if<Layout1 != Layout2>::type>
+template <class T, class U, int Rows, int Columns, eMatrixOrder Order1, eMatrixOrder Order2, eMatrixLayout Layout1, eMatrixLayout Layout2, bool Packed, class = typename std::enable_if<Layout1 != Layout2>::type>
 inline auto operator-(const Matrix<T, Rows, Columns, Order1, Layout1, Packed>& lhs,
 					  const Matrix<U, Rows, Columns, Order2, Layout2, Packed>& rhs) {
 	using V = traits::MatMulElemT<T, U>;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "MatrixImpl.hpp"
+
+
+namespace mathter {
+
+
+/// <summary> A pack of matrices stored as structure of arrays, one matrix per SIMD lane. </summary>
+/// <remarks> Each element holds the same element of all matrices in the pack. Lanes must be 2, 4 or 8. </remarks>
+template <class T, int Rows, int Columns, int Lanes = 8>
+class MatrixBatch {
+public:
+	using SimdT = Simd<T, Lanes>;
+	SimdT elements[Rows][Columns];
+
+	/// <summary> Does NOT zero-initialize values. </summary>
+	MatrixBatch() {}
+
+	/// <summary> The (row, col) element of all matrices in the pack. </summary>
+	SimdT& operator()(int row, int col) { return elements[row][col]; }
+	/// <summary> The (row, col) element of all matrices in the pack. </summary>
+	const SimdT& operator()(int row, int col) const { return elements[row][col]; }
+
+	/// <summary> Stores <paramref name="m"/> in the given lane. </summary>
+	template <eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+	void Set(int lane, const Matrix<T, Rows, Columns, Order, Layout, Packed>& m) {
+		for (int i = 0; i < Rows; ++i) {
+			for (int j = 0; j < Columns; ++j) {
+				elements[i][j].v[lane] = m(i, j);
+			}
+		}
+	}
+
+	/// <summary> Returns the matrix in the given lane. </summary>
+	template <eMatrixOrder Order = eMatrixOrder::FOLLOW_VECTOR, eMatrixLayout Layout = eMatrixLayout::ROW_MAJOR, bool Packed = false>
+	Matrix<T, Rows, Columns, Order, Layout, Packed> Get(int lane) const {
+		Matrix<T, Rows, Columns, Order, Layout, Packed> m;
+		for (int i = 0; i < Rows; ++i) {
+			for (int j = 0; j < Columns; ++j) {
+				m(i, j) = elements[i][j].v[lane];
+			}
+		}
+		return m;
+	}
+};
+
+
+/// <summary> A pack of vectors stored as structure of arrays, one vector per SIMD lane. </summary>
+/// <remarks> The right hand sides and solutions of <see cref="MatrixBatch"/> equation systems. </remarks>
+template <class T, int Dim, int Lanes = 8>
+class VectorBatch {
+public:
+	using SimdT = Simd<T, Lanes>;
+	SimdT elements[Dim];
+
+	/// <summary> Does NOT zero-initialize values. </summary>
+	VectorBatch() {}
+
+	/// <summary> The i-th element of all vectors in the pack. </summary>
+	SimdT& operator()(int i) { return elements[i]; }
+	/// <summary> The i-th element of all vectors in the pack. </summary>
+	const SimdT& operator()(int i) const { return elements[i]; }
+
+	/// <summary> Stores <paramref name="v"/> in the given lane. </summary>
+	template <bool Packed>
+	void Set(int lane, const Vector<T, Dim, Packed>& v) {
+		for (int i = 0; i < Dim; ++i) {
+			elements[i].v[lane] = v(i);
+		}
+	}
+
+	/// <summary> Returns the vector in the given lane. </summary>
+	template <bool Packed = false>
+	Vector<T, Dim, Packed> Get(int lane) const {
+		Vector<T, Dim, Packed> v;
+		for (int i = 0; i < Dim; ++i) {
+			v(i) = elements[i].v[lane];
+		}
+		return v;
+	}
+};
+
+
+} // namespace mathter
@@ -2,6 +2,7 @@
 
 #include "MatrixArithmetic.hpp"
 #include "MatrixImpl.hpp"
+#include "../Decompositions/DecomposeLU.hpp"
 
 
 namespace mathter {
@@ -18,10 +19,25 @@ T Trace(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
 }
 
 
+namespace impl {
+	/// <summary> The determinant of a 2x2 matrix held in a single register, in all lanes. </summary>
+	/// <remarks> The same for either layout, as the diagonal is in lanes 0 and 3 for both. </remarks>
+	template <class SimdT>
+	inline SimdT SingleRegisterDeterminant(const SimdT& m) {
+		const SimdT products = SimdT::mul(m, SimdT::template shuffle<0, 1, 2, 3>(m)); // a*d, b*c, c*b, d*a
+		return SimdT::sub(SimdT::template shuffle<0, 0, 0, 0>(products), SimdT::template shuffle<1, 1, 1, 1>(products));
+	}
+} // namespace impl
+
 /// <summary> Returns the determinant of a 2x2 matrix. </summary>
 template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 T Determinant(const Matrix<T, 2, 2, Order, Layout, Packed>& m) {
-	return m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+	if constexpr (impl::IsSingleRegister<T, 2, 2, Packed>) {
+		return impl::SingleRegisterDeterminant(m.simd).v[0];
+	}
+	else {
+		return m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+	}
 }
 
 /// <summary> Returns the determinant of a 3x3matrix. </summary>
@@ -47,102 +63,161 @@ T Determinant(const Matrix<T, 3, 3, Order, Layout, Packed>& m) {
 	return det;
 }
 
+namespace impl {
+	/// <summary> The 2x2 minors of a 4x4 matrix, shared by <see cref="Determinant"/> and <see cref="Inverse"/>. </summary>
+	/// <remarks> Stripe j is taken as column j, which gives the same determinant and the transposed adjugate.
+	///		minors[k] is the minor of column pair k, in rows 2 and 3 in lanes x and y, and in rows 0 and 1 in lanes z and w.
+	///		The column pairs are 01, 02, 03, 12, 13, 23. </remarks>
+	template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+	void PairMinors(const Matrix<T, 4, 4, Order, Layout, Packed>& m, Vector<T, 4, false> (&minors)[6]) {
+		using Vec4 = Vector<T, 4, false>;
+
+		// Rows 2, 2, 0, 0 and rows 3, 3, 1, 1 of each column.
+		Vec4 even[4], odd[4];
+		for (int j = 0; j < 4; ++j) {
+			even[j] = m.stripes[j].zzxx;
+			odd[j] = m.stripes[j].wwyy;
+		}
+
+		minors[0] = even[0] * odd[1] - odd[0] * even[1];
+		minors[1] = even[0] * odd[2] - odd[0] * even[2];
+		minors[2] = even[0] * odd[3] - odd[0] * even[3];
+		minors[3] = even[1] * odd[2] - odd[1] * even[2];
+		minors[4] = even[1] * odd[3] - odd[1] * even[3];
+		minors[5] = even[2] * odd[3] - odd[2] * even[3];
+	}
+
+	/// <summary> Laplace expansion by complementary 2x2 minors, the determinant is returned in all lanes. </summary>
+	template <class T>
+	Vector<T, 4, false> DeterminantFromPairMinors(const Vector<T, 4, false> (&minors)[6]) {
+		using Vec4 = Vector<T, 4, false>;
+
+		// Lanes x and y hold the same products, as do z and w.
+		const Vec4 products = minors[0] * Vec4(minors[5].zwxy) - minors[1] * Vec4(minors[4].zwxy) + minors[2] * Vec4(minors[3].zwxy);
+		return products + Vec4(products.zwxy);
+	}
+} // namespace impl
+
+
 /// <summary> Returns the determinant of a 4x4matrix. </summary>
 template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 T Determinant(const Matrix<T, 4, 4, Order, Layout, Packed>& m) {
-	using Vec3 = Vector<T, 3, false>;
-	using Vec4 = Vector<T, 4, false>;
+	Vector<T, 4, false> minors[6];
+	impl::PairMinors(m, minors);
+	return impl::DeterminantFromPairMinors(minors).x;
+}
 
-	Vec4 evenPair = { 1, -1, -1, 1 };
-	Vec4 oddPair = { -1, 1, 1, -1 };
-
-	const Vec4& r0 = m.stripes[0];
-	const Vec4& r1 = m.stripes[1];
-	const Vec4& r2 = m.stripes[2];
-	const Vec4& r3 = m.stripes[3];
-
-	Vec4 r2_zwzw = r2.zwzw;
-	Vec4 r0_yyxx = r0.yyxx;
-	Vec4 r1_wwxy = r1.wwxy;
-	Vec4 r2_xyzz = r2.xyzz;
-	Vec4 r3_wwww = r3.wwww;
-	Vec4 r1_zzxy = r1.zzxy;
-	Vec4 r0_yxyx = r0.yxyx;
-	Vec4 r3_xxyy = r3.xxyy;
-	Vec4 r1_wzwz = r1.wzwz;
-	Vec4 r2_xyww = r2.xyww;
-	Vec4 r3_zzzz = r3.zzzz;
-
-	Vec3 r2_yxz = r2.yxz;
-	Vec3 r3_xzy = r3.xzy;
-	Vec3 r2_xzy = r2.xzy;
-	Vec3 r3_yxz = r3.yxz;
-	Vec3 r2_yxw = r2.yxw;
-	Vec3 r1_zyx = r1.zyx;
-	Vec3 r3_yxw = r3.yxw;
-	Vec3 r2_xwy = r2.xwy;
-	Vec3 r3_xwy = r3.xwy;
-	Vec3 r1_wyx = r1.wyx;
-	T r0_w = r0.w;
-	T r0_z = r0.z;
-
-	T det = Dot(evenPair, r0_yyxx * r1_wzwz * r2_zwzw * r3_xxyy)
-			+ Dot(oddPair, r0_yxyx * r1_wwxy * r2_xyww * r3_zzzz)
-			+ Dot(evenPair, r0_yxyx * r1_zzxy * r2_xyzz * r3_wwww)
-			+ (r0_w * Dot(r1_zyx, r2_yxz * r3_xzy - r2_xzy * r3_yxz))
-			+ (r0_z * Dot(r1_wyx, r2_xwy * r3_yxw - r2_yxw * r3_xwy));
 
-	return det;
-}
+namespace impl {
+	constexpr int BitCount(int bits) {
+		return bits == 0 ? 0 : (bits & 1) + BitCount(bits >> 1);
+	}
+
+	/// <summary> Laplace expansion of the minor of the Columns mask along its first row, from column J on. </summary>
+	/// <remarks> The minor is made of the last BitCount(Columns) rows of m. </remarks>
+	template <int Dim, int Columns, int J, bool Negative, class T, class MatrixT>
+	T ExpandMinor(const MatrixT& m, const T (&minors)[1 << Dim]) {
+		if constexpr (J == Dim) {
+			return T(0);
+		}
+		else if constexpr (((Columns >> J) & 1) != 0) {
+			constexpr int row = Dim - BitCount(Columns);
+			const T term = m(row, J) * minors[Columns & ~(1 << J)];
+			const T rest = ExpandMinor<Dim, Columns, J + 1, !Negative>(m, minors);
+			return Negative ? rest - term : rest + term;
+		}
+		else {
+			return ExpandMinor<Dim, Columns, J + 1, Negative>(m, minors);
+		}
+	}
+
+	/// <summary> Fills minors[Columns] for all masks from Columns on, in an order where the smaller minors are ready. </summary>
+	template <int Dim, int Columns, class T, class MatrixT>
+	void ExpandMinors(const MatrixT& m, T (&minors)[1 << Dim]) {
+		if constexpr (Columns < (1 << Dim)) {
+			minors[Columns] = ExpandMinor<Dim, Columns, 0, false>(m, minors);
+			ExpandMinors<Dim, Columns + 1>(m, minors);
+		}
+	}
+} // namespace impl
 
 
 /// <summary> Returns the determinant of the matrix. </summary>
+/// <remarks> Up to 6x6, it's a Laplace expansion where each minor is computed once: the minors of the bottom k rows
+///		over all column subsets are built from those of the bottom k-1 rows. That's 80 multiplications for 5x5 and 192 for 6x6,
+///		without pivoting or divisions. Larger matrices go through <see cref="DecomposeLUP"/>. </remarks>
 template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 T Determinant(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
-	// only works if L's diagonal is 1s
-	int parity;
-	auto [L, U, P] = DecomposeLUP(m, parity);
-	T prod = U(0, 0);
-	for (int i = 1; i < U.RowCount(); ++i) {
-		prod *= U(i, i);
+	if constexpr (Dim <= 6) {
+		T minors[1 << Dim];
+		minors[0] = T(1);
+		impl::ExpandMinors<Dim, 1>(m, minors);
+		return minors[(1 << Dim) - 1];
+	}
+	else {
+		// only works if L's diagonal is 1s
+		int parity;
+		auto [L, U, P] = DecomposeLUP(m, parity);
+		T prod = U(0, 0);
+		for (int i = 1; i < U.RowCount(); ++i) {
+			prod *= U(i, i);
+		}
+		return parity * prod;
 	}
-	return parity * prod;
 }
 
 /// <summary> Transposes the matrix in-place. </summary>
 template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 Matrix<T, Columns, Rows, Order, Layout, Packed> Transpose(const Matrix<T, Rows, Columns, Order, Layout, Packed>& m) {
 	Matrix<T, Columns, Rows, Order, Layout, Packed> result;
-	for (int i = 0; i < m.RowCount(); ++i) {
-		for (int j = 0; j < m.ColumnCount(); ++j) {
-			result(j, i) = m(i, j);
+	if constexpr (impl::IsSingleRegister<T, Rows, Columns, Packed>) {
+		result.simd = decltype(m.simd)::template shuffle<3, 1, 2, 0>(m.simd);
+	}
+	else if constexpr (Rows == Columns && impl::HasShuffleTranspose<T, Rows, Packed>) {
+		impl::ShuffleTranspose(m.stripes, result.stripes);
+	}
+	else {
+		for (int i = 0; i < m.RowCount(); ++i) {
+			for (int j = 0; j < m.ColumnCount(); ++j) {
+				result(j, i) = m(i, j);
+			}
 		}
 	}
 	return result;
 }
 
 
-/// <summary> Returns the inverse of a 2x2 matrix. </summary>
+/// <summary> Returns the inverse of a 2x2 matrix, and its determinant in <paramref name="determinant"/>. </summary>
 template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-auto Inverse(const Matrix<T, 2, 2, Order, Layout, Packed>& m) {
+auto Inverse(const Matrix<T, 2, 2, Order, Layout, Packed>& m, T& determinant) {
 	Matrix<T, 2, 2, Order, Layout, Packed> result;
 
-	const auto& r0 = m.stripes[0];
-	const auto& r1 = m.stripes[1];
+	if constexpr (impl::IsSingleRegister<T, 2, 2, Packed>) {
+		// The adjugate swaps the diagonal and negates the off-diagonal, in either layout.
+		using SimdT = decltype(m.simd);
+		const SimdT determinants = impl::SingleRegisterDeterminant(m.simd);
+		const SimdT adjugate = SimdT::mul(SimdT::template shuffle<0, 2, 1, 3>(m.simd), SimdT::set(1.0f, -1.0f, -1.0f, 1.0f));
+		result.simd = SimdT::div(adjugate, determinants);
+		determinant = determinants.v[0];
+	}
+	else {
+		const auto& r0 = m.stripes[0];
+		const auto& r1 = m.stripes[1];
 
-	result.stripes[0] = { r1.y, -r0.y };
-	result.stripes[1] = { -r1.x, r0.x };
+		result.stripes[0] = { r1.y, -r0.y };
+		result.stripes[1] = { -r1.x, r0.x };
 
-	auto det = T(1) / (r0.x * r1.y - r0.y * r1.x);
-	result *= det;
+		determinant = r0.x * r1.y - r0.y * r1.x;
+		result *= T(1) / determinant;
+	}
 
 	return result;
 }
 
 
-/// <summary> Returns the inverse of a 3x3 matrix. </summary>
+/// <summary> Returns the inverse of a 3x3 matrix, and its determinant in <paramref name="determinant"/>. </summary>
 template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-auto Inverse(const Matrix<T, 3, 3, Order, Layout, Packed>& m) {
+auto Inverse(const Matrix<T, 3, 3, Order, Layout, Packed>& m, T& determinant) {
 	Matrix<T, 3, 3, Order, Layout, Packed> result;
 
 	using Vec3 = Vector<T, 3, false>;
@@ -170,134 +245,119 @@ auto Inverse(const Matrix<T, 3, 3, Order, Layout, Packed>& m) {
 	result.stripes[1] = { c0[1], c1[1], c2[1] };
 	result.stripes[2] = { c0[2], c1[2], c2[2] };
 
-	T det = T(1) / Dot(r0_zyx, r1_xzy * r2_yxz - r1_yxz * r2_xzy);
+	determinant = Dot(r0_zyx, r1_xzy * r2_yxz - r1_yxz * r2_xzy);
+	const T invDet = T(1) / determinant;
 
-	result.stripes[0] *= det;
-	result.stripes[1] *= det;
-	result.stripes[2] *= det;
+	result.stripes[0] *= invDet;
+	result.stripes[1] *= invDet;
+	result.stripes[2] *= invDet;
 
 	return result;
 }
 
 
-/// <summary> Returns the inverse of a 4x4 matrix. </summary>
+/// <summary> Returns the inverse of a 4x4 matrix, and its determinant in <paramref name="determinant"/>. </summary>
+/// <remarks> Both are built from the same 2x2 minors, see <see cref="impl::PairMinors"/>. </remarks>
 template <class T, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-auto Inverse(const Matrix<T, 4, 4, Order, Layout, Packed>& m) {
-	Matrix<T, 4, 4, Order, Layout, Packed> result;
-
-	using Vec3 = Vector<T, 3, false>;
+auto Inverse(const Matrix<T, 4, 4, Order, Layout, Packed>& m, T& determinant) {
 	using Vec4 = Vector<T, 4, false>;
 
-	Vec4 even = { 1, -1, 1, -1 };
-	Vec4 odd = { -1, 1, -1, 1 };
-	Vec4 evenPair = { 1, -1, -1, 1 };
-	Vec4 oddPair = { -1, 1, 1, -1 };
-
-	const Vec4& r0 = m.stripes[0];
-	const Vec4& r1 = m.stripes[1];
-	const Vec4& r2 = m.stripes[2];
-	const Vec4& r3 = m.stripes[3];
-
-	Vec4 r0_wwwz = r0.wwwz;
-	Vec4 r0_yxxx = r0.yxxx;
-	Vec4 r0_zzyy = r0.zzyy;
-	Vec4 r1_wwwz = r1.wwwz;
-	Vec4 r1_yxxx = r1.yxxx;
-	Vec4 r1_zzyy = r1.zzyy;
-	Vec4 r2_wwwz = r2.wwwz;
-	Vec4 r2_yxxx = r2.yxxx;
-	Vec4 r2_zzyy = r2.zzyy;
-	Vec4 r3_wwwz = r3.wwwz;
-	Vec4 r3_yxxx = r3.yxxx;
-	Vec4 r3_zzyy = r3.zzyy;
-
-	Vec4 r0_wwwz_r1_yxxx = r0_wwwz * r1_yxxx;
-	Vec4 r0_wwwz_r1_zzyy = r0_wwwz * r1_zzyy;
-	Vec4 r0_yxxx_r1_wwwz = r0_yxxx * r1_wwwz;
-	Vec4 r0_yxxx_r1_zzyy = r0_yxxx * r1_zzyy;
-	Vec4 r0_zzyy_r1_wwwz = r0_zzyy * r1_wwwz;
-	Vec4 r0_zzyy_r1_yxxx = r0_zzyy * r1_yxxx;
-	Vec4 r2_wwwz_r3_yxxx = r2_wwwz * r3_yxxx;
-	Vec4 r2_wwwz_r3_zzyy = r2_wwwz * r3_zzyy;
-	Vec4 r2_yxxx_r3_wwwz = r2_yxxx * r3_wwwz;
-	Vec4 r2_yxxx_r3_zzyy = r2_yxxx * r3_zzyy;
-	Vec4 r2_zzyy_r3_wwwz = r2_zzyy * r3_wwwz;
-	Vec4 r2_zzyy_r3_yxxx = r2_zzyy * r3_yxxx;
-
-	Vec4 c0 = odd * (r1_wwwz * r2_zzyy_r3_yxxx - r1_zzyy * r2_wwwz_r3_yxxx - r1_wwwz * r2_yxxx_r3_zzyy + r1_yxxx * r2_wwwz_r3_zzyy + r1_zzyy * r2_yxxx_r3_wwwz - r1_yxxx * r2_zzyy_r3_wwwz);
-	Vec4 c1 = even * (r0_wwwz * r2_zzyy_r3_yxxx - r0_zzyy * r2_wwwz_r3_yxxx - r0_wwwz * r2_yxxx_r3_zzyy + r0_yxxx * r2_wwwz_r3_zzyy + r0_zzyy * r2_yxxx_r3_wwwz - r0_yxxx * r2_zzyy_r3_wwwz);
-	Vec4 c2 = odd * (r0_wwwz_r1_zzyy * r3_yxxx - r0_zzyy_r1_wwwz * r3_yxxx - r0_wwwz_r1_yxxx * r3_zzyy + r0_yxxx_r1_wwwz * r3_zzyy + r0_zzyy_r1_yxxx * r3_wwwz - r0_yxxx_r1_zzyy * r3_wwwz);
-	Vec4 c3 = even * (r0_wwwz_r1_zzyy * r2_yxxx - r0_zzyy_r1_wwwz * r2_yxxx - r0_wwwz_r1_yxxx * r2_zzyy + r0_yxxx_r1_wwwz * r2_zzyy + r0_zzyy_r1_yxxx * r2_wwwz - r0_yxxx_r1_zzyy * r2_wwwz);
-
-	result.stripes[0] = { c0[0], c1[0], c2[0], c3[0] };
-	result.stripes[1] = { c0[1], c1[1], c2[1], c3[1] };
-	result.stripes[2] = { c0[2], c1[2], c2[2], c3[2] };
-	result.stripes[3] = { c0[3], c1[3], c2[3], c3[3] };
-
-	Vec4 r2_zwzw = r2.zwzw;
-	Vec4 r0_yyxx = r0.yyxx;
-	Vec4 r1_wwxy = r1.wwxy;
-	Vec4 r2_xyzz = r2.xyzz;
-	Vec4 r3_wwww = r3.wwww;
-	Vec4 r1_zzxy = r1.zzxy;
-	Vec4 r0_yxyx = r0.yxyx;
-	Vec4 r3_xxyy = r3.xxyy;
-	Vec4 r1_wzwz = r1.wzwz;
-	Vec4 r2_xyww = r2.xyww;
-	Vec4 r3_zzzz = r3.zzzz;
-
-	Vec3 r2_yxz = r2.yxz;
-	Vec3 r3_xzy = r3.xzy;
-	Vec3 r2_xzy = r2.xzy;
-	Vec3 r3_yxz = r3.yxz;
-	Vec3 r2_yxw = r2.yxw;
-	Vec3 r1_zyx = r1.zyx;
-	Vec3 r3_yxw = r3.yxw;
-	Vec3 r2_xwy = r2.xwy;
-	Vec3 r3_xwy = r3.xwy;
-	Vec3 r1_wyx = r1.wyx;
-	T r0_w = r0.w;
-	T r0_z = r0.z;
-
-	T det = Dot(evenPair, r0_yyxx * r1_wzwz * r2_zwzw * r3_xxyy)
-			+ Dot(oddPair, r0_yxyx * r1_wwxy * r2_xyww * r3_zzzz)
-			+ Dot(evenPair, r0_yxyx * r1_zzxy * r2_xyzz * r3_wwww)
-			+ (r0_w * Dot(r1_zyx, r2_yxz * r3_xzy - r2_xzy * r3_yxz))
-			+ (r0_z * Dot(r1_wyx, r2_xwy * r3_yxw - r2_yxw * r3_xwy));
-
-	T invDet = 1 / det;
+	Vec4 minors[6];
+	impl::PairMinors(m, minors);
+	const Vec4 determinants = impl::DeterminantFromPairMinors(minors);
+	determinant = determinants.x;
 
-	result.stripes[0] *= invDet;
-	result.stripes[1] *= invDet;
-	result.stripes[2] *= invDet;
-	result.stripes[3] *= invDet;
+	// Each column as rows 1, 0, 3, 2 with the cofactor signs applied.
+	const Vec4 sign = { T(1), T(-1), T(1), T(-1) };
+	Vec4 q[4];
+	for (int j = 0; j < 4; ++j) {
+		q[j] = sign * Vec4(m.stripes[j].yxwz);
+	}
 
+	// The adjugate of the matrix whose columns are the stripes, by rows. That's the transpose of what we need.
+	const Vec4 invDet = Vec4(T(1)) / determinants;
+	std::array<Vec4, 4> adjugate = {
+		(q[1] * minors[5] - q[2] * minors[4] + q[3] * minors[3]) * invDet,
+		(q[2] * minors[2] - q[0] * minors[5] - q[3] * minors[1]) * invDet,
+		(q[0] * minors[4] - q[1] * minors[2] + q[3] * minors[0]) * invDet,
+		(q[1] * minors[1] - q[0] * minors[3] - q[2] * minors[0]) * invDet,
+	};
+
+	Matrix<T, 4, 4, Order, Layout, Packed> result;
+	if constexpr (impl::HasShuffleTranspose<T, 4, false>) {
+		std::array<Vec4, 4> transposed;
+		impl::ShuffleTranspose(adjugate, transposed);
+		for (int i = 0; i < 4; ++i) {
+			result.stripes[i] = transposed[i];
+		}
+	}
+	else {
+		for (int i = 0; i < 4; ++i) {
+			result.stripes[i] = { adjugate[0][i], adjugate[1][i], adjugate[2][i], adjugate[3][i] };
+		}
+	}
 	return result;
 }
 
 
 
-/// <summary> Returns the inverse of the matrix. </summary>
+/// <summary> Returns the inverse of the matrix, and its determinant in <paramref name="determinant"/>. </summary>
+/// <remarks> Gauss-Jordan elimination with partial pivoting, on whole rows, see <see cref="impl::EliminationRow"/>.
+///		The determinant is the product of the pivots. </remarks>
 template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
-Matrix<T, Dim, Dim, Order, Layout, Packed> Inverse(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
-	Matrix<T, Dim, Dim, Order, Layout, Packed> ret;
+Matrix<T, Dim, Dim, Order, Layout, Packed> Inverse(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m, T& determinant) {
+	using Row = impl::EliminationRow<T, Dim>;
+	Row a[Dim];
+	Row b[Dim];
+	impl::LoadRows(m, a);
+	for (int i = 0; i < Dim; ++i) {
+		b[i] = Row(T(0));
+		b[i](i) = T(1);
+	}
 
-	auto LUP = DecomposeLUP(m);
+	// Reduce a to upper triangular, repeating the row operations on b.
+	determinant = T(1);
+	for (int j = 0; j < Dim; ++j) {
+		const int largest = impl::PivotRow(a, j);
+		if (largest != j) {
+			std::swap(a[j], a[largest]);
+			std::swap(b[j], b[largest]);
+			determinant = -determinant;
+		}
+		determinant *= a[j](j);
+
+		const T invPivot = T(1) / a[j](j);
+		for (int i = j + 1; i < Dim; ++i) {
+			const T multiplier = a[i](j) * invPivot;
+			a[i] -= a[j] * multiplier;
+			b[i] -= b[j] * multiplier;
+		}
+	}
 
-	Vector<T, Dim, Packed> b(0);
-	Vector<T, Dim, Packed> x;
-	for (int col = 0; col < Dim; ++col) {
-		b(std::max(0, col - 1)) = 0;
-		b(col) = 1;
-		x = LUP.Solve(b);
-		for (int i = 0; i < Dim; ++i) {
-			ret(i, col) = x(i);
+	// Back substitution, b becomes the inverse.
+	for (int i = Dim - 1; i >= 0; --i) {
+		b[i] *= T(1) / a[i](i);
+		for (int k = 0; k < i; ++k) {
+			b[k] -= b[i] * a[k](i);
 		}
 	}
 
+	Matrix<T, Dim, Dim, Order, Layout, Packed> ret;
+	for (int i = 0; i < Dim; ++i) {
+		for (int j = 0; j < Dim; ++j) {
+			ret(i, j) = b[i](j);
+		}
+	}
 	return ret;
 }
 
+/// <summary> Returns the inverse of the matrix. </summary>
+template <class T, int Dim, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
+Matrix<T, Dim, Dim, Order, Layout, Packed> Inverse(const Matrix<T, Dim, Dim, Order, Layout, Packed>& m) {
+	T determinant;
+	return Inverse(m, determinant);
+}
+
 /// <summary> Calculates the square of the Frobenius norm of the matrix. </summary>
 template <class T, int Rows, int Columns, eMatrixOrder Order, eMatrixLayout Layout, bool Packed>
 T NormSquared(const Matrix<T, Rows, Columns, Order, Layout, Packed>& m) {
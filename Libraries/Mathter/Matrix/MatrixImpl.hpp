@@ -71,6 +71,86 @@ protected:
 };
 
 
+#ifdef MATHTER_SSE2_HACK
+/// <summary> A 2x2 float matrix keeps all four elements in a single SSE register. </summary>
+/// <remarks> The two stripes are adjacent in memory and alias the lanes of <see cref="simd"/>. </remarks>
+template <eMatrixOrder Order, eMatrixLayout Layout>
+class MatrixData<float, 2, 2, Order, Layout, false> {
+public:
+	/// <summary> Returns the number of columns of the matrix. </summary>
+	constexpr int ColumnCount() const {
+		return 2;
+	}
+	/// <summary> Returns the number of rows of the matrix. </summary>
+	constexpr int RowCount() const {
+		return 2;
+	}
+	/// <summary> Returns the number of columns of the matrix. </summary>
+	constexpr int Width() const {
+		return 2;
+	}
+	/// <summary> Returns the number of rows of the matrix. </summary>
+	constexpr int Height() const {
+		return 2;
+	}
+	static constexpr int StripeDim = 2;
+	static constexpr int StripeCount = 2;
+
+	using StripeVecT = Vector<float, 2, false>;
+	using SimdT = Simd<float, 4>;
+
+	MatrixData() {}
+	MatrixData(const MatrixData& rhs) { simd = rhs.simd; }
+	MatrixData(const StripeVecT& stripe0, const StripeVecT& stripe1) : stripes{ stripe0, stripe1 } {}
+	MatrixData& operator=(const MatrixData& rhs) {
+		simd = rhs.simd;
+		return *this;
+	}
+
+	union {
+		std::array<StripeVecT, 2> stripes;
+		/// <summary> The stripes one after the other, the first one in the low lanes. </summary>
+		SimdT simd;
+	};
+
+protected:
+	// Get element
+	inline float& GetElement(int row, int col) {
+		assert(row < RowCount());
+		assert(col < ColumnCount());
+		if constexpr (Layout == eMatrixLayout::ROW_MAJOR) {
+			return stripes[row][col];
+		}
+		else {
+			return stripes[col][row];
+		}
+	}
+	inline float GetElement(int row, int col) const {
+		assert(row < RowCount());
+		assert(col < ColumnCount());
+		if constexpr (Layout == eMatrixLayout::ROW_MAJOR) {
+			return stripes[row][col];
+		}
+		else {
+			return stripes[col][row];
+		}
+	}
+};
+#endif
+
+
+namespace impl {
+	/// <summary> Whether the matrix is held in a single SIMD register, see the 2x2 float <see cref="MatrixData"/>. </summary>
+	template <class T, int Rows, int Columns, bool Packed>
+	constexpr bool IsSingleRegister =
+#ifdef MATHTER_SSE2_HACK
+		std::is_same_v<T, float> && Rows == 2 && Columns == 2 && !Packed;
+#else
+		false;
+#endif
+} // namespace impl
+
+
 //------------------------------------------------------------------------------
 // Submatrix helper
 //------------------------------------------------------------------------------
@@ -191,6 +271,89 @@ private:
 };
 
 
+//------------------------------------------------------------------------------
+// Register transposes of square stripe blocks
+//------------------------------------------------------------------------------
+
+namespace impl {
+	/// <summary> Whether <see cref="ShuffleTranspose"/> is implemented for the stripe type. </summary>
+	template <class T, int Dim, bool Packed>
+	constexpr bool HasShuffleTranspose =
+#ifdef MATHTER_SSE2_HACK
+		std::is_same_v<T, float> && !Packed
+		&& ((Dim == 2 && sizeof(Vector<float, 2, false>) == 2 * sizeof(float)) || Dim == 3 || Dim == 4 || Dim == 8);
+#else
+		false;
+#endif
+
+	/// <summary> Transposes a square block of stripes with shuffles, without going through memory. </summary>
+	/// <remarks> Serves both as a transpose and as a conversion between row and column major layout.
+	///		The padding lane of 3 element stripes is zeroed. </remarks>
+	template <class T, int Dim, bool Packed, size_t Count>
+	void ShuffleTranspose(const std::array<Vector<T, Dim, Packed>, Count>& in, std::array<Vector<T, Dim, Packed>, Count>& out) {
+		static_assert(Count == Dim, "The block must be square.");
+		static_assert(HasShuffleTranspose<T, Dim, Packed>, "Use an element-wise transpose.");
+#ifdef MATHTER_SSE2_HACK
+		if constexpr (Dim == 2) {
+			// The two stripes are adjacent in memory.
+			const __m128 m = _mm_loadu_ps(in[0].data);
+			_mm_storeu_ps(out[0].data, _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+		else if constexpr (Dim == 3) {
+			__m128 r0 = in[0].simd.reg, r1 = in[1].simd.reg, r2 = in[2].simd.reg, r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			out[0].simd.reg = r0;
+			out[1].simd.reg = r1;
+			out[2].simd.reg = r2;
+		}
+		else if constexpr (Dim == 4) {
+			__m128 r0 = in[0].simd.reg, r1 = in[1].simd.reg, r2 = in[2].simd.reg, r3 = in[3].simd.reg;
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			out[0].simd.reg = r0;
+			out[1].simd.reg = r1;
+			out[2].simd.reg = r2;
+			out[3].simd.reg = r3;
+		}
+		else {
+#ifdef __AVX__
+			// Pair up the halves of rows i and i + 4 in the loads, then it's two 4x4 transposes per 128 bit lane.
+			__m256 rows[8];
+			for (int i = 0; i < 4; ++i) {
+				rows[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in[i].data)), _mm_loadu_ps(in[i + 4].data), 1);
+				rows[i + 4] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in[i].data + 4)), _mm_loadu_ps(in[i + 4].data + 4), 1);
+			}
+			for (int i = 0; i < 8; i += 4) {
+				const __m256 t0 = _mm256_unpacklo_ps(rows[i], rows[i + 1]);
+				const __m256 t1 = _mm256_unpackhi_ps(rows[i], rows[i + 1]);
+				const __m256 t2 = _mm256_unpacklo_ps(rows[i + 2], rows[i + 3]);
+				const __m256 t3 = _mm256_unpackhi_ps(rows[i + 2], rows[i + 3]);
+				out[i].simd.reg = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				out[i + 1].simd.reg = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				out[i + 2].simd.reg = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				out[i + 3].simd.reg = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+#else
+			// Transpose the four 4x4 blocks and swap the off-diagonal ones.
+			for (int blockRow = 0; blockRow < 2; ++blockRow) {
+				for (int blockCol = 0; blockCol < 2; ++blockCol) {
+					__m128 r0 = in[4 * blockCol + 0].simd.reg[blockRow];
+					__m128 r1 = in[4 * blockCol + 1].simd.reg[blockRow];
+					__m128 r2 = in[4 * blockCol + 2].simd.reg[blockRow];
+					__m128 r3 = in[4 * blockCol + 3].simd.reg[blockRow];
+					_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+					out[4 * blockRow + 0].simd.reg[blockCol] = r0;
+					out[4 * blockRow + 1].simd.reg[blockCol] = r1;
+					out[4 * blockRow + 2].simd.reg[blockCol] = r2;
+					out[4 * blockRow + 3].simd.reg[blockCol] = r3;
+				}
+			}
+#endif
+		}
+#endif
+	}
+} // namespace impl
+
+
 //------------------------------------------------------------------------------
 // Matrix class providing the common interface for all matrices
 //------------------------------------------------------------------------------
@@ -226,9 +389,15 @@ public:
 	// From same multiplication order
 	template <class T2, eMatrixLayout Layout2, bool Packed2>
 	Matrix(const Matrix<T2, Rows, Columns, Order, Layout2, Packed2>& rhs) {
-		for (int i = 0; i < RowCount(); ++i) {
-			for (int j = 0; j < ColumnCount(); ++j) {
-				(*this)(i, j) = rhs(i, j);
+		if constexpr (Rows == Columns && Layout2 != Layout && std::is_same_v<T2, T> && Packed2 == Packed
+					  && impl::HasShuffleTranspose<T, Rows, Packed>) {
+			impl::ShuffleTranspose(rhs.stripes, stripes); // Stripes of the other layout are our transposed stripes
+		}
+		else {
+			for (int i = 0; i < RowCount(); ++i) {
+				for (int j = 0; j < ColumnCount(); ++j) {
+					(*this)(i, j) = rhs(i, j);
+				}
 			}
 		}
 	}
@@ -236,9 +405,15 @@ public:
 	// From opposite multiplication order
 	template <class T2, eMatrixLayout Layout2, bool Packed2>
 	Matrix(const Matrix<T2, Columns, Rows, Order == eMatrixOrder::FOLLOW_VECTOR ? eMatrixOrder::PRECEDE_VECTOR : eMatrixOrder::FOLLOW_VECTOR, Layout2, Packed2>& rhs) {
-		for (int i = 0; i < RowCount(); ++i) {
-			for (int j = 0; j < ColumnCount(); ++j) {
-				(*this)(i, j) = rhs(j, i); // Transpose argument
+		if constexpr (Rows == Columns && Layout2 == Layout && std::is_same_v<T2, T> && Packed2 == Packed
+					  && impl::HasShuffleTranspose<T, Rows, Packed>) {
+			impl::ShuffleTranspose(rhs.stripes, stripes);
+		}
+		else {
+			for (int i = 0; i < RowCount(); ++i) {
+				for (int j = 0; j < ColumnCount(); ++j) {
+					(*this)(i, j) = rhs(j, i); // Transpose argument
+				}
 			}
 		}
 	}
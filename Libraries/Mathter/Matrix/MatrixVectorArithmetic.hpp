@@ -5,6 +5,31 @@
 namespace mathter {
 
 
+namespace impl {
+	/// <summary> Whether the dots of a Dim vector with Count stripes fit a single <see cref="Simd::dot4"/>. </summary>
+	template <class T, int Dim, int Count, bool Packed>
+	constexpr bool UseStripeDots() {
+		if constexpr ((Dim == 3 || Dim == 4) && (Count == 3 || Count == 4)
+					  && traits::HasSimd<Vector<T, Dim, Packed>>::value && traits::HasSimd<Vector<T, Count, Packed>>::value) {
+			return std::is_same<decltype(VectorData<T, Dim, Packed>::simd), Simd<T, 4>>::value
+				   && std::is_same<decltype(VectorData<T, Count, Packed>::simd), Simd<T, 4>>::value;
+		}
+		else {
+			return false;
+		}
+	}
+
+	/// <summary> The dot products of vec with each stripe, computed together and left in the lanes of the result. </summary>
+	template <class T, int Dim, size_t Count, bool Packed>
+	Vector<T, int(Count), Packed> StripeDots(const std::array<Vector<T, Dim, Packed>, Count>& stripes, const Vector<T, Dim, Packed>& vec) {
+		using SimdT = Simd<T, 4>;
+		// With 3 stripes, the last one is repeated in the unused lane.
+		return { Vector<T, int(Count), Packed>::FromSimd,
+				 SimdT::template dot4<Dim>(stripes[0].simd, stripes[1].simd, stripes[2].simd, stripes[Count - 1].simd, vec.simd) };
+	}
+} // namespace impl
+
+
 //------------------------------------------------------------------------------
 // Matrix-vector arithmetic
 //------------------------------------------------------------------------------
@@ -23,12 +48,17 @@ inline Vector<Rt, Mcol, Packed> operator*(const Vector<Vt, Vd, Packed>& vec, con
 
 template <class Vt, class Mt, int Vd, int Mcol, eMatrixOrder Morder, bool Packed, class Rt>
 inline Vector<Rt, Mcol, Packed> operator*(const Vector<Vt, Vd, Packed>& vec, const Matrix<Mt, Vd, Mcol, Morder, eMatrixLayout::COLUMN_MAJOR, Packed>& mat) {
-	Vector<Rt, Mcol, Packed> result;
+	if constexpr (std::is_same<Vt, Mt>::value && std::is_same<Vt, Rt>::value && impl::UseStripeDots<Vt, Vd, Mcol, Packed>()) {
+		return impl::StripeDots(mat.stripes, vec);
+	}
+	else {
+		Vector<Rt, Mcol, Packed> result;
 
-	for (int i = 0; i < Vd; ++i) {
-		result(i) = Dot(vec, mat.stripes[i]);
+		for (int i = 0; i < Mcol; ++i) {
+			result(i) = Dot(vec, mat.stripes[i]);
+		}
+		return result;
 	}
-	return result;
 }
 
 template <class Vt, class Mt, int Vd, int Mcol, eMatrixOrder Morder, eMatrixLayout Mlayout, bool Packed>
@@ -54,12 +84,17 @@ Vector<Rt, Vd, Packed> operator*(const Vector<Vt, Vd, Packed>& vec, const Matrix
 // M*v
 template <class Vt, class Mt, int Vd, int Mrow, eMatrixOrder Morder, bool Packed, class Rt>
 inline Vector<Rt, Mrow, Packed> operator*(const Matrix<Mt, Mrow, Vd, Morder, eMatrixLayout::ROW_MAJOR, Packed>& mat, const Vector<Vt, Vd, Packed>& vec) {
-	Vector<Rt, Mrow, Packed> result;
-	
-	for (int i = 0; i < Mrow; ++i) {
-		result(i) = Dot(vec, mat.stripes[i]);
+	if constexpr (std::is_same<Vt, Mt>::value && std::is_same<Vt, Rt>::value && impl::UseStripeDots<Vt, Vd, Mrow, Packed>()) {
+		return impl::StripeDots(mat.stripes, vec);
+	}
+	else {
+		Vector<Rt, Mrow, Packed> result;
+
+		for (int i = 0; i < Mrow; ++i) {
+			result(i) = Dot(vec, mat.stripes[i]);
+		}
+		return result;
 	}
-	return result;
 }
 
 template <class Vt, class Mt, int Vd, int Mrow, eMatrixOrder Morder, bool Packed, class Rt>
@@ -89,7 +124,7 @@ Vector<Rt, Vd, Packed> operator*(const Matrix<Mt, Vd, Vd + 1, Morder, Mlayout, P
 
 template <class Vt, class Mt, int Vd, eMatrixLayout Mlayout, eMatrixOrder Morder, bool Packed, class Rt = traits::MatMulElemT<Vt, Mt>>
 Vector<Rt, Vd, Packed> operator*(const Matrix<Mt, Vd + 1, Vd + 1, Morder, Mlayout, Packed>& mat, const Vector<Vt, Vd, Packed>& vec) {
-	auto res = (vec | Vt(1)) * mat;
+	auto res = mat * (vec | Vt(1));
 	res /= res(res.Dimension() - 1);
 	return (Vector<Rt, Vd, Packed>)res;
 }
@@ -7,6 +7,7 @@
 
 #include "Quaternion/QuaternionImpl.hpp"
 #include "Quaternion/QuaternionArithmetic.hpp"
+#include "Quaternion/QuaternionBatch.hpp"
 #include "Quaternion/QuaternionFunction.hpp"
 #include "Quaternion/QuaternionVectorArithmetic.hpp"
 #include "Quaternion/QuaternionCompare.hpp"
@@ -17,46 +17,40 @@ namespace mathter {
 	}
 
 
+	/// <summary> Flips the sign of the lanes of <paramref name="arg"/> whose template argument is negative. </summary>
+	template <int S0, int S1, int S2, int S3, class T>
+	inline Simd<T, 4> FlipSigns(const Simd<T, 4>& arg) {
+#ifdef MATHTER_SSE2_HACK
+		if constexpr (std::is_same_v<T, float>) {
+			Simd<T, 4> ret;
+			const __m128i mask = _mm_setr_epi32(S0 < 0 ? INT32_MIN : 0, S1 < 0 ? INT32_MIN : 0, S2 < 0 ? INT32_MIN : 0, S3 < 0 ? INT32_MIN : 0);
+			ret.reg = _mm_xor_ps(arg.reg, _mm_castsi128_ps(mask));
+			return ret;
+		}
+#endif
+		return Simd<T, 4>::mul(arg, Simd<T, 4>::set(T(S0), T(S1), T(S2), T(S3)));
+	}
+
+
 	template <class T, bool Packed>
 	typename std::enable_if<Quaternion<T, Packed>::SimdAccelerated, Quaternion<T, Packed>>::type Product(const Quaternion<T, Packed>& lhs, const Quaternion<T, Packed>& rhs) {
-		Quaternion<T, Packed> ret;
+		// With the lanes in (w, x, y, z) order, the product is the sum of each lhs element times a permutation of rhs:
+		// lw*(rw, rx, ry, rz) + lx*(-rx, rw, -rz, ry) + ly*(-ry, rz, rw, -rx) + lz*(-rz, -ry, rx, rw)
 		using SimdT = Simd<T, 4>;
 
-		SimdT dabc = lhs.vec.simd;
-		SimdT wxyz = rhs.vec.simd;
-		SimdT alternate;
-		alternate.v[0] = -1;
-		alternate.v[1] = 1;
-		alternate.v[2] = -1;
-		alternate.v[3] = 1;
-
-		// [ 3, 2, 1, 0 ]
-		// [ 0, 3, 2, 1 ]
-		SimdT t0 = SimdT::template shuffle<0, 0, 0, 0>(dabc);
-		SimdT t1 = SimdT::template shuffle<3, 0, 1, 2>(wxyz);
+		const SimdT l = lhs.vec.simd;
+		const SimdT r = rhs.vec.simd;
 
-		SimdT t2 = SimdT::template shuffle<1, 1, 1, 1>(dabc);
-		SimdT t3 = SimdT::template shuffle<2, 1, 0, 3>(wxyz);
+		const SimdT r1 = FlipSigns<-1, 1, -1, 1>(SimdT::template shuffle<2, 3, 0, 1>(r));
+		const SimdT r2 = FlipSigns<-1, 1, 1, -1>(SimdT::template shuffle<1, 0, 3, 2>(r));
+		const SimdT r3 = FlipSigns<-1, -1, 1, 1>(SimdT::template shuffle<0, 1, 2, 3>(r));
 
-		SimdT t4 = SimdT::template shuffle<2, 2, 2, 2>(dabc);
-		SimdT t5 = SimdT::template shuffle<3, 1, 0, 2>(wxyz);
-
-		SimdT m0 = SimdT::mul(t0, t1);
-		SimdT m1 = SimdT::mul(t2, t3);
-		SimdT m2 = SimdT::mul(t4, t5);
-
-		SimdT t6 = SimdT::template shuffle<3, 3, 3, 3>(dabc);
-		SimdT t7 = SimdT::template shuffle<0, 3, 1, 2>(wxyz);
-
-		SimdT m3 = SimdT::mul(t6, t7);
-
-		SimdT e = SimdT::add(m0, SimdT::mul(alternate, m1));
-		e = SimdT::template shuffle<1, 3, 0, 2>(e);
-		e = SimdT::add(e, SimdT::mul(alternate, m2));
-		e = SimdT::template shuffle<2, 0, 1, 3>(e);
-		e = SimdT::add(e, SimdT::mul(alternate, m3));
-		e = SimdT::template shuffle<3, 1, 0, 2>(e);
+		SimdT e = SimdT::mul(SimdT::template shuffle<0, 0, 0, 0>(l), r);
+		e = SimdT::mad(SimdT::template shuffle<1, 1, 1, 1>(l), r1, e);
+		e = SimdT::mad(SimdT::template shuffle<2, 2, 2, 2>(l), r2, e);
+		e = SimdT::mad(SimdT::template shuffle<3, 3, 3, 3>(l), r3, e);
 
+		Quaternion<T, Packed> ret;
 		ret.vec.simd = e;
 		return ret;
 	}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "QuaternionImpl.hpp"
+
+namespace mathter {
+
+
+/// <summary> A pack of quaternions stored as structure of arrays, one quaternion per SIMD lane. </summary>
+/// <remarks> Applying the same operation to many quaternions is much faster on batches than one quaternion at a time,
+///		since every instruction works on all lanes. Lanes must be 2, 4 or 8. </remarks>
+template <class T, int Lanes = 8>
+class QuaternionBatch {
+public:
+	using SimdT = Simd<T, Lanes>;
+	SimdT w, x, y, z;
+
+	/// <summary> Does NOT zero-initialize values. </summary>
+	QuaternionBatch() {}
+
+	/// <summary> Set values directly, each argument holds one element of all quaternions. </summary>
+	QuaternionBatch(const SimdT& w, const SimdT& x, const SimdT& y, const SimdT& z) : w(w), x(x), y(y), z(z) {}
+
+	/// <summary> Stores <paramref name="q"/> in the given lane. </summary>
+	template <bool Packed>
+	void Set(int lane, const Quaternion<T, Packed>& q) {
+		w.v[lane] = q.w;
+		x.v[lane] = q.x;
+		y.v[lane] = q.y;
+		z.v[lane] = q.z;
+	}
+
+	/// <summary> Returns the quaternion in the given lane. </summary>
+	template <bool Packed = false>
+	Quaternion<T, Packed> Get(int lane) const {
+		return { w.v[lane], x.v[lane], y.v[lane], z.v[lane] };
+	}
+};
+
+
+/// <summary> A pack of 3D vectors stored as structure of arrays, one vector per SIMD lane. </summary>
+template <class T, int Lanes = 8>
+class Vector3Batch {
+public:
+	using SimdT = Simd<T, Lanes>;
+	SimdT x, y, z;
+
+	/// <summary> Does NOT zero-initialize values. </summary>
+	Vector3Batch() {}
+
+	/// <summary> Set values directly, each argument holds one element of all vectors. </summary>
+	Vector3Batch(const SimdT& x, const SimdT& y, const SimdT& z) : x(x), y(y), z(z) {}
+
+	/// <summary> Stores <paramref name="v"/> in the given lane. </summary>
+	template <bool Packed>
+	void Set(int lane, const Vector<T, 3, Packed>& v) {
+		x.v[lane] = v.x;
+		y.v[lane] = v.y;
+		z.v[lane] = v.z;
+	}
+
+	/// <summary> Returns the vector in the given lane. </summary>
+	template <bool Packed = false>
+	Vector<T, 3, Packed> Get(int lane) const {
+		return { x.v[lane], y.v[lane], z.v[lane] };
+	}
+};
+
+
+namespace impl {
+	/// <summary> Returns a * b + c * d for each lane. </summary>
+	template <class SimdT>
+	SimdT MulAdd2(const SimdT& a, const SimdT& b, const SimdT& c, const SimdT& d) {
+		return SimdT::mad(a, b, SimdT::mul(c, d));
+	}
+
+	/// <summary> Returns the weight of the endpoint at parameter <paramref name="t"/> in the slerp of two unit quaternions. </summary>
+	/// <remarks> The polynomial of D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP", which approximates
+	///		sin(t*angle)/sin(angle) from cos(angle) without trigonometric functions. <paramref name="cosAngleM1"/> is cos(angle) - 1
+	///		and must be in [-1, 0]. The weight is off by at most about 2e-5 in that range. </remarks>
+	template <class T, int Lanes>
+	Simd<T, Lanes> SlerpWeight(const Simd<T, Lanes>& cosAngleM1, T t) {
+		using SimdT = Simd<T, Lanes>;
+		constexpr int numTerms = 8;
+		constexpr T mu = T(1.85298109240830);
+		const T t2 = t * t;
+
+		// The polynomial's ith coefficient is (u[i]*t^2 - v[i]) with u[i] = 1/(i*(2i+1)) and v[i] = i/(2i+1),
+		// the last term is scaled by mu to correct for truncation.
+		SimdT acc = SimdT::spread(T(1));
+		for (int i = numTerms; i >= 1; --i) {
+			const T scale = i == numTerms ? mu : T(1);
+			const T u = scale / T(i * (2 * i + 1));
+			const T v = scale * T(i) / T(2 * i + 1);
+			acc = SimdT::mad(SimdT::mul(cosAngleM1, u * t2 - v), acc, SimdT::spread(T(1)));
+		}
+		return SimdT::mul(acc, t);
+	}
+} // namespace impl
+
+
+/// <summary> The dot products of the quaternions in corresponding lanes. </summary>
+template <class T, int Lanes>
+Simd<T, Lanes> Dot(const QuaternionBatch<T, Lanes>& lhs, const QuaternionBatch<T, Lanes>& rhs) {
+	using SimdT = Simd<T, Lanes>;
+	SimdT dot = SimdT::mul(lhs.w, rhs.w);
+	dot = SimdT::mad(lhs.x, rhs.x, dot);
+	dot = SimdT::mad(lhs.y, rhs.y, dot);
+	dot = SimdT::mad(lhs.z, rhs.z, dot);
+	return dot;
+}
+
+/// <summary> Returns the unit quaternions of the same direction. </summary>
+template <class T, int Lanes>
+QuaternionBatch<T, Lanes> Normalize(const QuaternionBatch<T, Lanes>& q) {
+	using SimdT = Simd<T, Lanes>;
+	const SimdT invLength = SimdT::div(SimdT::spread(T(1)), SimdT::sqrt(Dot(q, q)));
+	return { SimdT::mul(q.w, invLength), SimdT::mul(q.x, invLength), SimdT::mul(q.y, invLength), SimdT::mul(q.z, invLength) };
+}
+
+/// <summary> Linear interpolation followed by normalization, along the shorter arc. </summary>
+/// <remarks> Unlike <see cref="Slerp"/>, the angular velocity is not constant, but is close to it for nearby quaternions. </remarks>
+template <class T, int Lanes>
+QuaternionBatch<T, Lanes> Nlerp(const QuaternionBatch<T, Lanes>& from, const QuaternionBatch<T, Lanes>& to, T t) {
+	using SimdT = Simd<T, Lanes>;
+	const SimdT weightFrom = SimdT::spread(T(1) - t);
+	const SimdT weightTo = SimdT::copysign(SimdT::spread(t), Dot(from, to));
+	const QuaternionBatch<T, Lanes> blend = {
+		impl::MulAdd2(from.w, weightFrom, to.w, weightTo),
+		impl::MulAdd2(from.x, weightFrom, to.x, weightTo),
+		impl::MulAdd2(from.y, weightFrom, to.y, weightTo),
+		impl::MulAdd2(from.z, weightFrom, to.z, weightTo),
+	};
+	return Normalize(blend);
+}
+
+/// <summary> Spherical linear interpolation between unit quaternions, along the shorter arc. </summary>
+/// <remarks> The weights are approximated by a polynomial, see <see cref="impl::SlerpWeight"/>.
+///		No trigonometric functions are evaluated and no lanes need special treatment for small angles. </remarks>
+template <class T, int Lanes>
+QuaternionBatch<T, Lanes> Slerp(const QuaternionBatch<T, Lanes>& from, const QuaternionBatch<T, Lanes>& to, T t) {
+	using SimdT = Simd<T, Lanes>;
+	const SimdT cosAngle = Dot(from, to);
+	const SimdT cosAngleM1 = SimdT::sub(SimdT::abs(cosAngle), T(1));
+	const SimdT weightFrom = impl::SlerpWeight(cosAngleM1, T(1) - t);
+	const SimdT weightTo = SimdT::copysign(impl::SlerpWeight(cosAngleM1, t), cosAngle);
+	return {
+		impl::MulAdd2(from.w, weightFrom, to.w, weightTo),
+		impl::MulAdd2(from.x, weightFrom, to.x, weightTo),
+		impl::MulAdd2(from.y, weightFrom, to.y, weightTo),
+		impl::MulAdd2(from.z, weightFrom, to.z, weightTo),
+	};
+}
+
+/// <summary> Rotates the vectors by the quaternions in corresponding lanes. </summary>
+/// <remarks> Computes q*v*q^-1 as v + w*t + u x t, where u is the vector part of q and t = 2(u x v) / |q|^2.
+///		The quaternions need not be normalized. </remarks>
+template <class T, int Lanes>
+Vector3Batch<T, Lanes> operator*(const QuaternionBatch<T, Lanes>& q, const Vector3Batch<T, Lanes>& vec) {
+	using SimdT = Simd<T, Lanes>;
+	const SimdT scale = SimdT::div(SimdT::spread(T(2)), Dot(q, q));
+	const SimdT tx = SimdT::mul(SimdT::sub(SimdT::mul(q.y, vec.z), SimdT::mul(q.z, vec.y)), scale);
+	const SimdT ty = SimdT::mul(SimdT::sub(SimdT::mul(q.z, vec.x), SimdT::mul(q.x, vec.z)), scale);
+	const SimdT tz = SimdT::mul(SimdT::sub(SimdT::mul(q.x, vec.y), SimdT::mul(q.y, vec.x)), scale);
+	return {
+		SimdT::add(SimdT::mad(q.w, tx, vec.x), SimdT::sub(SimdT::mul(q.y, tz), SimdT::mul(q.z, ty))),
+		SimdT::add(SimdT::mad(q.w, ty, vec.y), SimdT::sub(SimdT::mul(q.z, tx), SimdT::mul(q.x, tz))),
+		SimdT::add(SimdT::mad(q.w, tz, vec.z), SimdT::sub(SimdT::mul(q.x, ty), SimdT::mul(q.y, tx))),
+	};
+}
+
+
+} // namespace mathter
@@ -22,7 +22,7 @@ Quaternion<T, Packed> Exp(const Quaternion<T, Packed>& q) {
 	auto a = q.ScalarPart();
 	auto v = q.VectorPart();
 	T mag = Length(v);
-	T es = exp(a);
+	T es = std::exp(a);
 
 	Quaternion<T, Packed> ret = { std::cos(mag), v * (std::sin(mag) / mag) };
 	ret *= es;
@@ -36,7 +36,7 @@ Quaternion<T, Packed> Log(const Quaternion<T, Packed>& q) {
 	auto magq = Length(q);
 	auto vn = Normalize(q.VectorPart());
 
-	Quaternion ret = { std::log(magq), vn * std::acos(q.s / magq) };
+	Quaternion<T, Packed> ret = { std::log(magq), vn * std::acos(q.s / magq) };
 	return ret;
 }
 
@@ -62,9 +62,9 @@ T Length(const Quaternion<T, Packed>& q) {
 }
 
 /// <summary> Returns the unit quaternion of the same direction. Does not change this object. </summary>
-template <class T, bool Packed>
+template <ePrecision Precision = ePrecision::PRECISE, class T, bool Packed>
 Quaternion<T, Packed> Normalize(const Quaternion<T, Packed>& q) {
-	return Quaternion<T, Packed>{ q.vec.Normalized() };
+	return Quaternion<T, Packed>{ Normalize<Precision>(q.vec) };
 }
 
 /// <summary> Returns the quaternion of opposite rotation. </summary>
@@ -76,7 +76,26 @@ Quaternion<T, Packed> Inverse(const Quaternion<T, Packed>& q) {
 /// <summary> Check if the quaternion is a unit quaternion, with some tolerance for floats. </summary>
 template <class T, bool Packed>
 bool IsNormalized(const Quaternion<T, Packed>& q) {
-	return q.vec.IsNormalized();
+	return IsNormalized(q.vec);
+}
+
+/// <summary> Spherical linear interpolation between two unit quaternions along the shorter arc. </summary>
+/// <remarks> Nearly parallel quaternions are interpolated linearly and normalized to avoid dividing by zero. </remarks>
+template <class T, bool Packed>
+Quaternion<T, Packed> Slerp(const Quaternion<T, Packed>& from, const Quaternion<T, Packed>& to, T t) {
+	T cosAngle = Dot(from.vec, to.vec);
+	const auto target = cosAngle < T(0) ? -to.vec : to.vec;
+	cosAngle = std::abs(cosAngle);
+
+	if (cosAngle > T(0.9995)) {
+		return Quaternion<T, Packed>{ Normalize(from.vec + t * (target - from.vec)) };
+	}
+
+	const T angle = std::acos(cosAngle);
+	const T invSinAngle = T(1) / std::sqrt(T(1) - cosAngle * cosAngle);
+	const T weightFrom = std::sin((T(1) - t) * angle) * invSinAngle;
+	const T weightTo = std::sin(t * angle) * invSinAngle;
+	return Quaternion<T, Packed>{ from.vec * weightFrom + target * weightTo };
 }
 
 
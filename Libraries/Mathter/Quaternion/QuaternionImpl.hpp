@@ -236,11 +236,40 @@ protected:
 		auto elem = [&mat](int i, int j) -> U {
 			return Order == eMatrixOrder::PRECEDE_VECTOR ? mat(i, j) : mat(j, i);
 		};
-		w = std::sqrt(1 + elem(0, 0) + elem(1, 1) + elem(2, 2)) * T(0.5);
-		T div = T(1) / (T(4) * w);
-		x = (elem(2, 1) - elem(1, 2)) * div;
-		y = (elem(0, 2) - elem(2, 0)) * div;
-		z = (elem(1, 0) - elem(0, 1)) * div;
+		// Computes the largest of w, x, y, z from the diagonal first, so that it can safely divide the rest.
+		const T trace = elem(0, 0) + elem(1, 1) + elem(2, 2);
+		if (trace > T(0)) {
+			T s2 = std::sqrt(T(1) + trace) * T(2);
+			T div = T(1) / s2;
+			w = T(0.25) * s2;
+			x = (elem(2, 1) - elem(1, 2)) * div;
+			y = (elem(0, 2) - elem(2, 0)) * div;
+			z = (elem(1, 0) - elem(0, 1)) * div;
+		}
+		else if (elem(0, 0) > elem(1, 1) && elem(0, 0) > elem(2, 2)) {
+			T s2 = std::sqrt(T(1) + elem(0, 0) - elem(1, 1) - elem(2, 2)) * T(2);
+			T div = T(1) / s2;
+			w = (elem(2, 1) - elem(1, 2)) * div;
+			x = T(0.25) * s2;
+			y = (elem(0, 1) + elem(1, 0)) * div;
+			z = (elem(0, 2) + elem(2, 0)) * div;
+		}
+		else if (elem(1, 1) > elem(2, 2)) {
+			T s2 = std::sqrt(T(1) + elem(1, 1) - elem(0, 0) - elem(2, 2)) * T(2);
+			T div = T(1) / s2;
+			w = (elem(0, 2) - elem(2, 0)) * div;
+			x = (elem(0, 1) + elem(1, 0)) * div;
+			y = T(0.25) * s2;
+			z = (elem(1, 2) + elem(2, 1)) * div;
+		}
+		else {
+			T s2 = std::sqrt(T(1) + elem(2, 2) - elem(0, 0) - elem(1, 1)) * T(2);
+			T div = T(1) / s2;
+			w = (elem(1, 0) - elem(0, 1)) * div;
+			x = (elem(0, 2) + elem(2, 0)) * div;
+			y = (elem(1, 2) + elem(2, 1)) * div;
+			z = T(0.25) * s2;
+		}
 	}
 };
 
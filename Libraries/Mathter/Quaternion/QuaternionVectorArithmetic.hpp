@@ -5,25 +5,44 @@
 namespace mathter {
 
 
-/// <summary> Rotates (and scales) vector by quaternion. </summary>
+namespace impl {
+	/// <summary> Computes the sandwich product q*v*q^-1 without forming the intermediate quaternions, where q^-1 = conj(q) / |q|^2. </summary>
+	/// <remarks> Expanded, the product is v + w*t + u x t, where u is the vector part of q and t = 2(u x v) / |q|^2.
+	///		Dividing by |q|^2 makes it a pure rotation for any non-zero q, not only for unit quaternions. </remarks>
+	template <class T, bool QPacked, bool PackedA>
+	Vector<T, 3, PackedA> Rotate(const Quaternion<T, QPacked>& q, const Vector<T, 3, PackedA>& vec) {
+		const T scale = T(2) / (q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+		const T tx = scale * (q.y * vec.z - q.z * vec.y);
+		const T ty = scale * (q.z * vec.x - q.x * vec.z);
+		const T tz = scale * (q.x * vec.y - q.y * vec.x);
+		return {
+			vec.x + q.w * tx + (q.y * tz - q.z * ty),
+			vec.y + q.w * ty + (q.z * tx - q.x * tz),
+			vec.z + q.w * tz + (q.x * ty - q.y * tx),
+		};
+	}
+} // namespace impl
+
+
+/// <summary> Rotates vector by quaternion. </summary>
+/// <remarks> The quaternion need not be normalized, only its direction matters. </remarks>
 template <class T, bool QPacked, bool PackedA>
 Vector<T, 3, PackedA> operator*(const Quaternion<T, QPacked>& q, const Vector<T, 3, PackedA>& vec) {
-	// sandwich product
-	return Vector<T, 3, PackedA>(q * Quaternion<T, QPacked>(vec) * Inverse(q));
+	return impl::Rotate(q, vec);
 }
 
-/// <summary> Rotates (and scales) vector by quaternion. </summary>
+/// <summary> Rotates vector by quaternion. </summary>
+/// <remarks> The quaternion need not be normalized, only its direction matters. </remarks>
 template <class T, bool QPacked, bool PackedA>
 Vector<T, 3, PackedA> operator*(const Vector<T, 3, PackedA>& vec, const Quaternion<T, QPacked>& q) {
-	// sandwich product
-	return Vector<T, 3, PackedA>(q * Quaternion<T, QPacked>(vec) * Inverse(q));
+	return impl::Rotate(q, vec);
 }
 
-/// <summary> Rotates (and scales) vector by quaternion. </summary>
+/// <summary> Rotates vector by quaternion. </summary>
+/// <remarks> The quaternion need not be normalized, only its direction matters. </remarks>
 template <class T, bool QPacked, bool PackedA>
 Vector<T, 3, PackedA>& operator*=(Vector<T, 3, PackedA>& vec, const Quaternion<T, QPacked>& q) {
-	// sandwich product
-	return vec = Vector<T, 3, PackedA>(q * Quaternion<T, QPacked>(vec) * Inverse(q));
+	return vec = impl::Rotate(q, vec);
 }
 
 
@@ -7,6 +7,11 @@
 
 #include <cstdint>
 #include <cassert>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#include "SimdMath.hpp"
 
 
 namespace mathter {
@@ -96,6 +101,254 @@ public:
 		return res;
 	}
 
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::sqrt(arg.v[i]));
+		return res;
+	}
+
+	/// <summary> The reciprocal of the square root, lane by lane. </summary>
+	/// <remarks> Specializations may approximate it, see <see cref="ePrecision::FAST"/>. </remarks>
+	static inline Simd rsqrt(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(1) / T(std::sqrt(arg.v[i]));
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::abs(arg.v[i]));
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::copysign(magnitude.v[i], sign.v[i]));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::nearbyint(arg.v[i]));
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::floor(arg.v[i]));
+		return res;
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	static inline Simd exp2i(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(std::ldexp(T(1), int(arg.v[i])));
+		return res;
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	static inline Simd frexp(const Simd &arg, Simd &exponent) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i) {
+			int exp;
+			res.v[i] = T(std::frexp(arg.v[i], &exp));
+			exponent.v[i] = T(exp);
+		}
+		return res;
+	}
+
+	/// <summary> Sine lane by lane. Floats use the approximation at impl::SimdSinCos. </summary>
+	static inline Simd sin(const Simd &arg) {
+		Simd res, cosine;
+		sincos(arg, res, cosine);
+		return res;
+	}
+
+	/// <summary> Cosine lane by lane. Floats use the approximation at impl::SimdSinCos. </summary>
+	static inline Simd cos(const Simd &arg) {
+		Simd sine, res;
+		sincos(arg, sine, res);
+		return res;
+	}
+
+	/// <summary> Sine and cosine lane by lane. Floats use the approximation at impl::SimdSinCos. </summary>
+	static inline void sincos(const Simd &arg, Simd &sine, Simd &cosine) {
+		if constexpr (std::is_same<T, float>::value) {
+			impl::SimdSinCos(arg, sine, cosine);
+		}
+		else {
+			for (int i = 0; i < Dim; ++i) {
+				sine.v[i] = T(std::sin(arg.v[i]));
+				cosine.v[i] = T(std::cos(arg.v[i]));
+			}
+		}
+	}
+
+	/// <summary> The angle of the points (x, y) lane by lane. Floats use the approximation at impl::SimdAtan2. </summary>
+	static inline Simd atan2(const Simd &y, const Simd &x) {
+		if constexpr (std::is_same<T, float>::value) {
+			return impl::SimdAtan2(y, x);
+		}
+		else {
+			Simd res;
+			for (int i = 0; i < Dim; ++i)
+				res.v[i] = T(std::atan2(y.v[i], x.v[i]));
+			return res;
+		}
+	}
+
+	/// <summary> Arc cosine lane by lane. Floats use the approximation at impl::SimdAcos. </summary>
+	static inline Simd acos(const Simd &arg) {
+		if constexpr (std::is_same<T, float>::value) {
+			return impl::SimdAcos(arg);
+		}
+		else {
+			return lanes(arg, [](T value) { return std::acos(value); });
+		}
+	}
+
+	/// <summary> Exponential function lane by lane. Floats use the approximation at impl::SimdExp. </summary>
+	static inline Simd exp(const Simd &arg) {
+		if constexpr (std::is_same<T, float>::value) {
+			return impl::SimdExp(arg);
+		}
+		else {
+			return lanes(arg, [](T value) { return std::exp(value); });
+		}
+	}
+
+	/// <summary> Natural logarithm lane by lane. Floats use the approximation at impl::SimdLog. </summary>
+	static inline Simd log(const Simd &arg) {
+		if constexpr (std::is_same<T, float>::value) {
+			return impl::SimdLog(arg);
+		}
+		else {
+			return lanes(arg, [](T value) { return std::log(value); });
+		}
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = lhs.v[i] < rhs.v[i] ? lhs.v[i] : rhs.v[i];
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = lhs.v[i] > rhs.v[i] ? lhs.v[i] : rhs.v[i];
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		std::memset(&res, 0, sizeof(res));
+		for (int i = 0; i < Dim; ++i)
+			if (lhs.v[i] < rhs.v[i])
+				std::memset(&res.v[i], 0xFF, sizeof(T));
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		std::memset(&res, 0, sizeof(res));
+		for (int i = 0; i < Dim; ++i)
+			if (lhs.v[i] <= rhs.v[i])
+				std::memset(&res.v[i], 0xFF, sizeof(T));
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		std::memset(&res, 0, sizeof(res));
+		for (int i = 0; i < Dim; ++i)
+			if (lhs.v[i] == rhs.v[i])
+				std::memset(&res.v[i], 0xFF, sizeof(T));
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = fromBits(toBits(lhs.v[i]) & toBits(rhs.v[i]));
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = fromBits(toBits(lhs.v[i]) | toBits(rhs.v[i]));
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = fromBits(~toBits(arg.v[i]));
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		int bits = 0;
+		for (int i = 0; i < Dim; ++i)
+			bits |= int(toBits(arg.v[i]) >> (8 * sizeof(T) - 1)) << i;
+		return bits;
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		static const Simd zero = spread(T(0));
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = std::memcmp(&mask.v[i], &zero.v[i], sizeof(T)) != 0 ? ifTrue.v[i] : ifFalse.v[i];
+		return res;
+	}
+
+	/// <summary> Shifts the bits of each lane left by <paramref name="count"/>. Integers only. </summary>
+	static inline Simd shiftLeft(const Simd &arg, int count) {
+		static_assert(std::is_integral<T>::value, "Only integers can be shifted.");
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(BitsT(arg.v[i]) << count);
+		return res;
+	}
+
+	/// <summary> Shifts the bits of each lane right by <paramref name="count"/>, copying the sign bit. Integers only. </summary>
+	static inline Simd shiftRight(const Simd &arg, int count) {
+		static_assert(std::is_integral<T>::value, "Only integers can be shifted.");
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(arg.v[i] >> count);
+		return res;
+	}
+
+	/// <summary> Converts the lanes to <typeparamref name="U"/> like a static_cast, floats to integers by truncation. </summary>
+	template<class U>
+	static inline Simd<U, Dim> convert(const Simd &arg) {
+		Simd<U, Dim> res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = U(arg.v[i]);
+		return res;
+	}
+
 	template<class... Args>
 	static inline Simd set(Args... args) {
 		Simd res;
@@ -106,6 +359,20 @@ public:
 		return res;
 	}
 
+	/// <summary> Loads Dim consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const T *ptr) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = ptr[i];
+		return res;
+	}
+
+	/// <summary> Stores the lanes to Dim consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(T *ptr, const Simd &arg) {
+		for (int i = 0; i < Dim; ++i)
+			ptr[i] = arg.v[i];
+	}
+
 	template<int Count = Dim>
 	static inline T dot(const Simd &lhs, const Simd &rhs) {
 		static_assert(Count <= Dim, "Number of elements to dot must be smaller or equal to dimension.");
@@ -116,6 +383,19 @@ public:
 		return sum;
 	}
 
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count = Dim>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
+
+	/// <summary> The dot products of the first Count lanes of each lhs with rhs, the i-th in lane i. </summary>
+	template<int Count = Dim>
+	static inline Simd dot4(const Simd &lhs0, const Simd &lhs1, const Simd &lhs2, const Simd &lhs3, const Simd &rhs) {
+		static_assert(Dim == 4, "Only 4-lane types hold four dot products.");
+		return set(dot<Count>(lhs0, rhs), dot<Count>(lhs1, rhs), dot<Count>(lhs2, rhs), dot<Count>(lhs3, rhs));
+	}
+
 	template<int i0, int i1>
 	static inline Simd shuffle(Simd arg) {
 		static_assert(Dim == 2, "Only for 2-way simd.");
@@ -150,6 +430,29 @@ public:
 		ret.v[0] = arg.v[i7];
 		return ret;
 	}
+
+private:
+	template<class Op>
+	static inline Simd lanes(const Simd &arg, Op op) {
+		Simd res;
+		for (int i = 0; i < Dim; ++i)
+			res.v[i] = T(op(arg.v[i]));
+		return res;
+	}
+
+	using BitsT = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+	static inline BitsT toBits(T value) {
+		BitsT bits;
+		std::memcpy(&bits, &value, sizeof(T));
+		return bits;
+	}
+
+	static inline T fromBits(BitsT bits) {
+		T value;
+		std::memcpy(&value, &bits, sizeof(T));
+		return value;
+	}
 };
 
 } // namespace mathter
@@ -160,4 +463,8 @@ public:
 #include "Simd_SSE2.hpp"
 #define MATHTER_SSE2_HACK
 
+#if defined(__AVX__)
+#include "Simd_AVX.hpp"
+#endif
+
 #endif
\ No newline at end of file
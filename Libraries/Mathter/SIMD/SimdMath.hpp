@@ -0,0 +1,197 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include <limits>
+
+namespace mathter {
+
+// Polynomial approximations of the elementary functions for float Simd types.
+// They are written in terms of the Simd interface, so every float specialization shares them.
+// The coefficients are those of the Cephes library's single precision functions.
+// The errors are measured against the double precision standard library.
+namespace impl {
+	/// <summary> Reduces the arguments to [-pi/4, pi/4] around the nearest multiple of pi/2, <paramref name="quadrant"/>. </summary>
+	/// <remarks> pi/2 is split into three parts, the product of the quadrant and the first two is exact for |arg| &lt;= 8192. </remarks>
+	template <class SimdT>
+	SimdT ReduceQuadrant(const SimdT& arg, SimdT& quadrant) {
+		quadrant = SimdT::round(SimdT::mul(arg, 0.636619772367581343f));
+		SimdT reduced = SimdT::mad(quadrant, SimdT::spread(-1.5703125f), arg);
+		reduced = SimdT::mad(quadrant, SimdT::spread(-4.837512969970703125e-4f), reduced);
+		return SimdT::mad(quadrant, SimdT::spread(-7.54978995489188216e-8f), reduced);
+	}
+
+	/// <summary> Flips the sign of the lanes where the mask is set. </summary>
+	template <class SimdT>
+	SimdT NegateWhere(const SimdT& mask, const SimdT& arg) {
+		return SimdT::select(mask, SimdT::sub(SimdT::spread(0.0f), arg), arg);
+	}
+
+	/// <summary> Whether the integers in the lanes leave a remainder of 2 or 3 when divided by 4. </summary>
+	template <class SimdT>
+	SimdT IsUpperHalfOf4(const SimdT& integer) {
+		const SimdT quarter = SimdT::mul(integer, 0.25f);
+		return SimdT::lessEqual(SimdT::spread(0.5f), SimdT::sub(quarter, SimdT::floor(quarter)));
+	}
+
+	/// <summary> Sine and cosine of the same arguments, sharing the range reduction. </summary>
+	/// <remarks> The absolute error is below 8e-8 for |arg| &lt;= 8192, within 1.6 ulp away from the zeros.
+	///		Larger arguments lose accuracy in the range reduction. </remarks>
+	template <class SimdT>
+	void SimdSinCos(const SimdT& arg, SimdT& sine, SimdT& cosine) {
+		SimdT quadrant;
+		const SimdT r = ReduceQuadrant(arg, quadrant);
+		const SimdT r2 = SimdT::mul(r, r);
+
+		// sin(r) = r + r^3 * P(r^2)
+		SimdT sinPoly = SimdT::mad(r2, SimdT::spread(-1.9515295891e-4f), SimdT::spread(8.3321608736e-3f));
+		sinPoly = SimdT::mad(sinPoly, r2, SimdT::spread(-1.6666654611e-1f));
+		const SimdT sinR = SimdT::mad(SimdT::mul(sinPoly, r2), r, r);
+
+		// cos(r) = 1 - r^2 / 2 + r^4 * Q(r^2)
+		SimdT cosPoly = SimdT::mad(r2, SimdT::spread(2.443315711809948e-5f), SimdT::spread(-1.388731625493765e-3f));
+		cosPoly = SimdT::mad(cosPoly, r2, SimdT::spread(4.166664568298827e-2f));
+		const SimdT cosR = SimdT::add(SimdT::mad(SimdT::mul(cosPoly, r2), r2, SimdT::mul(r2, -0.5f)), SimdT::spread(1.0f));
+
+		// Odd quadrants swap sine and cosine. Sine is negative in quadrants 2 and 3, cosine in 1 and 2.
+		const SimdT half = SimdT::mul(quadrant, 0.5f);
+		const SimdT odd = SimdT::less(SimdT::floor(half), half);
+		sine = NegateWhere(IsUpperHalfOf4(quadrant), SimdT::select(odd, cosR, sinR));
+		cosine = NegateWhere(IsUpperHalfOf4(SimdT::add(quadrant, SimdT::spread(1.0f))), SimdT::select(odd, sinR, cosR));
+	}
+
+	/// <summary> Arc tangent of arguments in [0, 1]. </summary>
+	template <class SimdT>
+	SimdT AtanUnit(const SimdT& arg) {
+		// Above tan(pi/8), atan(t) = pi/4 + atan((t - 1) / (t + 1)).
+		const SimdT one = SimdT::spread(1.0f);
+		const SimdT large = SimdT::less(SimdT::spread(0.414213562373095049f), arg);
+		const SimdT t = SimdT::select(large, SimdT::div(SimdT::sub(arg, one), SimdT::add(arg, one)), arg);
+		const SimdT offset = SimdT::select(large, SimdT::spread(0.785398163397448310f), SimdT::spread(0.0f));
+
+		// atan(t) = t + t^3 * P(t^2)
+		const SimdT t2 = SimdT::mul(t, t);
+		SimdT poly = SimdT::mad(t2, SimdT::spread(8.05374449538e-2f), SimdT::spread(-1.38776856032e-1f));
+		poly = SimdT::mad(poly, t2, SimdT::spread(1.99777106478e-1f));
+		poly = SimdT::mad(poly, t2, SimdT::spread(-3.33329491539e-1f));
+		return SimdT::add(offset, SimdT::mad(SimdT::mul(poly, t2), t, t));
+	}
+
+	/// <summary> The angle of the point (x, y) from the x axis, in [-pi, pi]. </summary>
+	/// <remarks> At most 3.2 ulp of error. Follows std::atan2 for zeros, signed zeros and infinities. </remarks>
+	template <class SimdT>
+	SimdT SimdAtan2(const SimdT& y, const SimdT& x) {
+		const SimdT zero = SimdT::spread(0.0f);
+		const SimdT absY = SimdT::abs(y);
+		const SimdT absX = SimdT::abs(x);
+		const SimdT larger = SimdT::max(absY, absX);
+		const SimdT smaller = SimdT::min(absY, absX);
+
+		// Equal magnitudes, infinite ones included, are on the diagonal. Both zero is on the x axis.
+		SimdT ratio = SimdT::div(smaller, larger);
+		ratio = SimdT::select(SimdT::equal(smaller, larger), SimdT::spread(1.0f), ratio);
+		ratio = SimdT::select(SimdT::equal(larger, zero), zero, ratio);
+
+		SimdT angle = AtanUnit(ratio);
+		angle = SimdT::select(SimdT::less(absX, absY), SimdT::sub(SimdT::spread(1.57079632679489662f), angle), angle);
+		angle = SimdT::select(SimdT::less(SimdT::copysign(SimdT::spread(1.0f), x), zero), SimdT::sub(SimdT::spread(3.14159265358979324f), angle), angle);
+		angle = SimdT::copysign(angle, y);
+
+		// Min and max may drop NaNs, the sum of the magnitudes keeps them.
+		const SimdT sum = SimdT::add(absX, absY);
+		return SimdT::select(SimdT::equal(sum, sum), angle, sum);
+	}
+
+	/// <summary> The arc cosine, in [0, pi]. </summary>
+	/// <remarks> At most 1.3 ulp of error. Arguments outside [-1, 1] give NaN. </remarks>
+	template <class SimdT>
+	SimdT SimdAcos(const SimdT& arg) {
+		const SimdT magnitude = SimdT::abs(arg);
+
+		// Above 1/2, acos(a) = 2 asin(sqrt((1 - a) / 2)) keeps the argument of the polynomial small.
+		const SimdT large = SimdT::less(SimdT::spread(0.5f), magnitude);
+		const SimdT z = SimdT::select(large, SimdT::mul(SimdT::sub(SimdT::spread(1.0f), magnitude), 0.5f), SimdT::mul(magnitude, magnitude));
+		const SimdT s = SimdT::select(large, SimdT::sqrt(z), magnitude);
+
+		// asin(s) = s + s^3 * P(s^2)
+		SimdT poly = SimdT::mad(z, SimdT::spread(4.2163199048e-2f), SimdT::spread(2.4181311049e-2f));
+		poly = SimdT::mad(poly, z, SimdT::spread(4.5470025998e-2f));
+		poly = SimdT::mad(poly, z, SimdT::spread(7.4953002686e-2f));
+		poly = SimdT::mad(poly, z, SimdT::spread(1.6666752422e-1f));
+		const SimdT asin = SimdT::mad(SimdT::mul(poly, z), s, s);
+
+		const SimdT nearZero = SimdT::sub(SimdT::spread(1.57079632679489662f), SimdT::copysign(asin, arg));
+		const SimdT twice = SimdT::add(asin, asin);
+		const SimdT nearOne = SimdT::select(SimdT::less(arg, SimdT::spread(0.0f)), SimdT::sub(SimdT::spread(3.14159265358979324f), twice), twice);
+		return SimdT::select(large, nearOne, nearZero);
+	}
+
+	/// <summary> The exponential function, base e. </summary>
+	/// <remarks> At most 1 ulp of error. Overflows to infinity above 88.72 and underflows to zero below -103.9. </remarks>
+	template <class SimdT>
+	SimdT SimdExp(const SimdT& arg) {
+		// Clamped to keep the exponent of 2^n in range, the results still overflow and underflow past the limits.
+		// The clamp is ordered so that NaNs pass through.
+		const SimdT x = SimdT::min(SimdT::spread(89.0f), SimdT::max(SimdT::spread(-104.0f), arg));
+
+		// e^x = 2^n * e^r, with r = x - n ln(2) in [-ln(2)/2, ln(2)/2].
+		const SimdT n = SimdT::round(SimdT::mul(x, 1.44269504088896341f));
+		SimdT r = SimdT::mad(n, SimdT::spread(-0.693359375f), x);
+		r = SimdT::mad(n, SimdT::spread(2.12194440e-4f), r);
+
+		// e^r = 1 + r + r^2 * P(r)
+		SimdT poly = SimdT::mad(r, SimdT::spread(1.9875691500e-4f), SimdT::spread(1.3981999507e-3f));
+		poly = SimdT::mad(poly, r, SimdT::spread(8.3334519073e-3f));
+		poly = SimdT::mad(poly, r, SimdT::spread(4.1665795894e-2f));
+		poly = SimdT::mad(poly, r, SimdT::spread(1.6666665459e-1f));
+		poly = SimdT::mad(poly, r, SimdT::spread(5.0000001201e-1f));
+		const SimdT expR = SimdT::add(SimdT::mad(poly, SimdT::mul(r, r), r), SimdT::spread(1.0f));
+
+		// 2^n in two steps, as n can be out of the range of normal floats at both ends.
+		const SimdT n1 = SimdT::floor(SimdT::mul(n, 0.5f));
+		const SimdT n2 = SimdT::sub(n, n1);
+		return SimdT::mul(SimdT::mul(expR, SimdT::exp2i(n1)), SimdT::exp2i(n2));
+	}
+
+	/// <summary> The natural logarithm. </summary>
+	/// <remarks> At most 0.9 ulp of error. Follows std::log for zeros, negative numbers, infinity and denormals. </remarks>
+	template <class SimdT>
+	SimdT SimdLog(const SimdT& arg) {
+		// Denormals are scaled into the normal range, frexp only reads the exponent bits.
+		const SimdT denormal = SimdT::less(arg, SimdT::spread(std::numeric_limits<float>::min()));
+		SimdT exponent;
+		SimdT mantissa = SimdT::frexp(SimdT::select(denormal, SimdT::mul(arg, 8388608.0f), arg), exponent);
+		exponent = SimdT::select(denormal, SimdT::sub(exponent, 23.0f), exponent);
+
+		// Moves the mantissa to [sqrt(1/2) - 1, sqrt(2) - 1), centering the polynomial around zero.
+		const SimdT small = SimdT::less(mantissa, SimdT::spread(0.707106781186547524f));
+		exponent = SimdT::select(small, SimdT::sub(exponent, 1.0f), exponent);
+		const SimdT m = SimdT::sub(SimdT::select(small, SimdT::add(mantissa, mantissa), mantissa), SimdT::spread(1.0f));
+
+		// log(1 + m) = m - m^2 / 2 + m^3 * P(m)
+		const SimdT m2 = SimdT::mul(m, m);
+		SimdT poly = SimdT::mad(m, SimdT::spread(7.0376836292e-2f), SimdT::spread(-1.1514610310e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(1.1676998740e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(-1.2420140846e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(1.4249322787e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(-1.6668057665e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(2.0000714765e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(-2.4999993993e-1f));
+		poly = SimdT::mad(poly, m, SimdT::spread(3.3333331174e-1f));
+		SimdT y = SimdT::mul(SimdT::mul(poly, m), m2);
+		y = SimdT::mad(exponent, SimdT::spread(-2.12194440e-4f), y);
+		y = SimdT::mad(m2, SimdT::spread(-0.5f), y);
+		SimdT result = SimdT::mad(exponent, SimdT::spread(0.693359375f), SimdT::add(m, y));
+
+		const SimdT infinity = SimdT::spread(std::numeric_limits<float>::infinity());
+		result = SimdT::select(SimdT::equal(arg, infinity), infinity, result);
+		result = SimdT::select(SimdT::equal(arg, SimdT::spread(0.0f)), SimdT::sub(SimdT::spread(0.0f), infinity), result);
+		// Negative numbers and NaNs.
+		return SimdT::select(SimdT::lessEqual(SimdT::spread(0.0f), arg), result, SimdT::spread(std::numeric_limits<float>::quiet_NaN()));
+	}
+} // namespace impl
+
+} // namespace mathter
@@ -0,0 +1,304 @@
+//==============================================================================
+// This software is distributed under The Unlicense.
+// For more information, please refer to <http://unlicense.org/>
+//==============================================================================
+
+#pragma once
+
+#include <immintrin.h>
+
+namespace mathter {
+//------------------------------------------------------------------------------
+// FLOAT
+//------------------------------------------------------------------------------
+
+// Specialization for float8, using AVX
+template<>
+union alignas(32) Simd<float, 8> {
+	__m256 reg;
+	float v[8];
+
+
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_mul_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_div_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_add_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_sub_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd mul(const Simd &lhs, float rhs) {
+		Simd res;
+		res.reg = _mm256_mul_ps(lhs.reg, _mm256_set1_ps(rhs));
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, float rhs) {
+		Simd res;
+		res.reg = _mm256_div_ps(lhs.reg, _mm256_set1_ps(rhs));
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, float rhs) {
+		Simd res;
+		res.reg = _mm256_add_ps(lhs.reg, _mm256_set1_ps(rhs));
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, float rhs) {
+		Simd res;
+		res.reg = _mm256_sub_ps(lhs.reg, _mm256_set1_ps(rhs));
+		return res;
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(float value) {
+		Simd res;
+		res.reg = _mm256_set1_ps(value);
+		return res;
+	}
+
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg = _mm256_sqrt_ps(arg.reg);
+		return res;
+	}
+
+	/// <summary> The approximate reciprocal of the square root, lane by lane, to within 2.4e-7 relative error. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		// One Newton-Raphson step on the 12 bit estimate: y * (1.5 - 0.5 * x * y * y).
+		Simd res;
+		const __m256 y = _mm256_rsqrt_ps(arg.reg);
+		const __m256 halfArg = _mm256_mul_ps(_mm256_set1_ps(0.5f), arg.reg);
+		res.reg = _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfArg, _mm256_mul_ps(y, y))));
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		res.reg = _mm256_andnot_ps(signMask, arg.reg);
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		res.reg = _mm256_or_ps(_mm256_andnot_ps(signMask, magnitude.reg), _mm256_and_ps(signMask, sign.reg));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		res.reg = _mm256_round_ps(arg.reg, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		res.reg = _mm256_floor_ps(arg.reg);
+		return res;
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	static inline Simd exp2i(const Simd &arg) {
+		// Moves n + 127 into the exponent bits, the mantissa stays zero.
+		Simd res;
+		res.reg = _mm256_castsi256_ps(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(arg.reg, _mm256_set1_ps(127.0f)), _mm256_set1_ps(8388608.0f))));
+		return res;
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	static inline Simd frexp(const Simd &arg, Simd &exponent) {
+		Simd res;
+		const __m256 exponentMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000));
+		const __m256 biased = _mm256_cvtepi32_ps(_mm256_castps_si256(_mm256_and_ps(arg.reg, exponentMask)));
+		exponent.reg = _mm256_sub_ps(_mm256_mul_ps(biased, _mm256_set1_ps(1.0f / 8388608.0f)), _mm256_set1_ps(126.0f));
+		res.reg = _mm256_or_ps(_mm256_andnot_ps(exponentMask, arg.reg), _mm256_set1_ps(0.5f));
+		return res;
+	}
+
+	/// <summary> Sine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd sin(const Simd &arg) {
+		Simd res, cosine;
+		impl::SimdSinCos(arg, res, cosine);
+		return res;
+	}
+
+	/// <summary> Cosine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd cos(const Simd &arg) {
+		Simd sine, res;
+		impl::SimdSinCos(arg, sine, res);
+		return res;
+	}
+
+	/// <summary> Sine and cosine lane by lane, sharing the range reduction. </summary>
+	static inline void sincos(const Simd &arg, Simd &sine, Simd &cosine) {
+		impl::SimdSinCos(arg, sine, cosine);
+	}
+
+	/// <summary> The angle of the points (x, y) lane by lane, with the accuracy given at impl::SimdAtan2. </summary>
+	static inline Simd atan2(const Simd &y, const Simd &x) {
+		return impl::SimdAtan2(y, x);
+	}
+
+	/// <summary> Arc cosine lane by lane, with the accuracy given at impl::SimdAcos. </summary>
+	static inline Simd acos(const Simd &arg) {
+		return impl::SimdAcos(arg);
+	}
+
+	/// <summary> Exponential function lane by lane, with the accuracy given at impl::SimdExp. </summary>
+	static inline Simd exp(const Simd &arg) {
+		return impl::SimdExp(arg);
+	}
+
+	/// <summary> Natural logarithm lane by lane, with the accuracy given at impl::SimdLog. </summary>
+	static inline Simd log(const Simd &arg) {
+		return impl::SimdLog(arg);
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_min_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_max_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_cmp_ps(lhs.reg, rhs.reg, _CMP_LT_OQ);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_cmp_ps(lhs.reg, rhs.reg, _CMP_LE_OQ);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_cmp_ps(lhs.reg, rhs.reg, _CMP_EQ_OQ);
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_and_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm256_or_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		res.reg = _mm256_xor_ps(arg.reg, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm256_movemask_ps(arg.reg);
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		Simd res;
+		res.reg = _mm256_blendv_ps(ifFalse.reg, ifTrue.reg, mask.reg);
+		return res;
+	}
+
+	static inline Simd set(float a, float b, float c, float d, float e, float f, float g, float h) {
+		Simd res;
+		res.reg = _mm256_setr_ps(a, b, c, d, e, f, g, h);
+		return res;
+	}
+
+	/// <summary> Loads 8 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const float *ptr) {
+		Simd res;
+		res.reg = _mm256_loadu_ps(ptr);
+		return res;
+	}
+
+	/// <summary> Stores the lanes to 8 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(float *ptr, const Simd &arg) {
+		_mm256_storeu_ps(ptr, arg.reg);
+	}
+
+
+	template<int Count>
+	static inline float dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 8, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		__m256 prod = _mm256_mul_ps(lhs.reg, rhs.reg);
+		if constexpr (Count < 8) {
+			prod = _mm256_blend_ps(_mm256_setzero_ps(), prod, (1 << Count) - 1);
+		}
+
+		__m128 sum = _mm_add_ps(_mm256_castps256_ps128(prod), _mm256_extractf128_ps(prod, 1));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+		return _mm_cvtss_f32(sum);
+	}
+
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
+
+
+	template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+	static inline Simd shuffle(const Simd &arg) {
+		Simd ret;
+		ret.v[7] = arg.v[i0];
+		ret.v[6] = arg.v[i1];
+		ret.v[5] = arg.v[i2];
+		ret.v[4] = arg.v[i3];
+		ret.v[3] = arg.v[i4];
+		ret.v[2] = arg.v[i5];
+		ret.v[1] = arg.v[i6];
+		ret.v[0] = arg.v[i7];
+		return ret;
+	}
+};
+
+} // namespace mathter
@@ -6,12 +6,405 @@
 #pragma once
 
 #include <emmintrin.h>
+#if defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#endif
+#if defined(__SSE4_2__) || defined(__AVX__)
+#include <nmmintrin.h>
+#endif
 
 namespace mathter {
+
+namespace impl {
+	/// <summary> Rounds to the nearest integer, halfway cases to even. </summary>
+	inline __m128 RoundPs(__m128 arg) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_round_ps(arg, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+		// Adding 2^23 leaves no bits for the fraction. Larger magnitudes are integers already.
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 noFraction = _mm_set1_ps(8388608.0f);
+		const __m128 magnitude = _mm_andnot_ps(signMask, arg);
+		const __m128 rounded = _mm_sub_ps(_mm_add_ps(magnitude, noFraction), noFraction);
+		const __m128 fractional = _mm_cmplt_ps(magnitude, noFraction);
+		const __m128 result = _mm_or_ps(_mm_and_ps(fractional, rounded), _mm_andnot_ps(fractional, magnitude));
+		return _mm_or_ps(result, _mm_and_ps(signMask, arg));
+#endif
+	}
+
+	/// <summary> Rounds towards negative infinity. </summary>
+	inline __m128 FloorPs(__m128 arg) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_floor_ps(arg);
+#else
+		const __m128 rounded = RoundPs(arg);
+		return _mm_sub_ps(rounded, _mm_and_ps(_mm_cmpgt_ps(rounded, arg), _mm_set1_ps(1.0f)));
+#endif
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	inline __m128 Exp2iPs(__m128 arg) {
+		// Moves n + 127 into the exponent bits, the mantissa stays zero.
+		return _mm_castsi128_ps(_mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(arg, _mm_set1_ps(127.0f)), _mm_set1_ps(8388608.0f))));
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	inline __m128 FrexpPs(__m128 arg, __m128 &exponent) {
+		const __m128 exponentMask = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+		const __m128 biased = _mm_cvtepi32_ps(_mm_castps_si128(_mm_and_ps(arg, exponentMask)));
+		exponent = _mm_sub_ps(_mm_mul_ps(biased, _mm_set1_ps(1.0f / 8388608.0f)), _mm_set1_ps(126.0f));
+		return _mm_or_ps(_mm_andnot_ps(exponentMask, arg), _mm_set1_ps(0.5f));
+	}
+
+	/// <summary> Rounds to the nearest integer, halfway cases to even. </summary>
+	inline __m128d RoundPd(__m128d arg) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_round_pd(arg, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+		// Adding 2^52 leaves no bits for the fraction. Larger magnitudes are integers already.
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		const __m128d noFraction = _mm_set1_pd(4503599627370496.0);
+		const __m128d magnitude = _mm_andnot_pd(signMask, arg);
+		const __m128d rounded = _mm_sub_pd(_mm_add_pd(magnitude, noFraction), noFraction);
+		const __m128d fractional = _mm_cmplt_pd(magnitude, noFraction);
+		const __m128d result = _mm_or_pd(_mm_and_pd(fractional, rounded), _mm_andnot_pd(fractional, magnitude));
+		return _mm_or_pd(result, _mm_and_pd(signMask, arg));
+#endif
+	}
+
+	/// <summary> Rounds towards negative infinity. </summary>
+	inline __m128d FloorPd(__m128d arg) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_floor_pd(arg);
+#else
+		const __m128d rounded = RoundPd(arg);
+		return _mm_sub_pd(rounded, _mm_and_pd(_mm_cmpgt_pd(rounded, arg), _mm_set1_pd(1.0)));
+#endif
+	}
+
+	/// <summary> The low 32 bits of the products. </summary>
+	inline __m128i MulloEpi32(__m128i lhs, __m128i rhs) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_mullo_epi32(lhs, rhs);
+#else
+		// pmuludq multiplies the even lanes to 64 bits. The low halves are the same for signed and unsigned.
+		const __m128i even = _mm_mul_epu32(lhs, rhs);
+		const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+	}
+
+	/// <summary> The quotients, truncated towards zero. Zero divisors give INT_MIN. </summary>
+	inline __m128i DivEpi32(__m128i lhs, __m128i rhs) {
+		// SSE has no integer division. Doubles hold 32 bit integers exactly, and the
+		// rounded quotient never reaches the next integer, so truncating it is exact.
+		const __m128d low = _mm_div_pd(_mm_cvtepi32_pd(lhs), _mm_cvtepi32_pd(rhs));
+		const __m128d high = _mm_div_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(lhs, lhs)), _mm_cvtepi32_pd(_mm_unpackhi_epi64(rhs, rhs)));
+		return _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+	}
+
+	/// <summary> The square roots, truncated towards zero. </summary>
+	inline __m128i SqrtEpi32(__m128i arg) {
+		const __m128d low = _mm_sqrt_pd(_mm_cvtepi32_pd(arg));
+		const __m128d high = _mm_sqrt_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(arg, arg)));
+		return _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+	}
+
+	/// <summary> The low 64 bits of the products. </summary>
+	inline __m128i MulloEpi64(__m128i lhs, __m128i rhs) {
+		// lo*lo + ((lo*hi + hi*lo) << 32), the hi*hi term falls off the top.
+		const __m128i low = _mm_mul_epu32(lhs, rhs);
+		const __m128i cross = _mm_add_epi64(_mm_mul_epu32(lhs, _mm_srli_epi64(rhs, 32)), _mm_mul_epu32(_mm_srli_epi64(lhs, 32), rhs));
+		return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+	}
+
+	/// <summary> All bits set in the lanes where lhs is greater than rhs. </summary>
+	inline __m128i CmpgtEpi64(__m128i lhs, __m128i rhs) {
+#if defined(__SSE4_2__) || defined(__AVX__)
+		return _mm_cmpgt_epi64(lhs, rhs);
+#else
+		// With equal signs, rhs - lhs can't overflow and is negative exactly when lhs > rhs.
+		// With different signs, lhs > rhs when rhs is the negative one.
+		const __m128i difference = _mm_sub_epi64(rhs, lhs);
+		const __m128i greater = _mm_or_si128(_mm_andnot_si128(lhs, rhs), _mm_andnot_si128(_mm_xor_si128(lhs, rhs), difference));
+		return _mm_shuffle_epi32(_mm_srai_epi32(greater, 31), _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+	}
+
+	/// <summary> All bits set in the lanes that are negative. </summary>
+	inline __m128i SignEpi64(__m128i arg) {
+		return _mm_shuffle_epi32(_mm_srai_epi32(arg, 31), _MM_SHUFFLE(3, 3, 1, 1));
+	}
+} // namespace impl
+
 //------------------------------------------------------------------------------
 // FLOAT
 //------------------------------------------------------------------------------
 
+// Specialization for float2, using the lower half of an SSE register
+// The storage stays 8 bytes so that Vec2 keeps its size and layout. Values move in and out with 64-bit movq,
+// which zeroes the upper half of the register.
+template<>
+union Simd<float, 2> {
+	float v[2];
+
+
+	/// <summary> Loads the lanes into the lower half of a register, the upper half is zero. </summary>
+	inline __m128 get() const {
+		return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(v)));
+	}
+
+	/// <summary> Stores the lower half of a register. </summary>
+	static inline Simd make(__m128 reg) {
+		Simd res;
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(res.v), _mm_castps_si128(reg));
+		return res;
+	}
+
+	/// <summary> Two pairs in one register, <paramref name="low"/> in lanes 0 and 1, <paramref name="high"/> in lanes 2 and 3. </summary>
+	static inline __m128 pack(const Simd &low, const Simd &high) {
+		return _mm_movelh_ps(low.get(), high.get());
+	}
+
+	/// <summary> Splits a register made by <see cref="pack"/> into its two pairs. </summary>
+	static inline void unpack(__m128 reg, Simd &low, Simd &high) {
+		low = make(reg);
+		high = make(_mm_movehl_ps(reg, reg));
+	}
+
+
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_mul_ps(lhs.get(), rhs.get()));
+	}
+
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		// The upper lanes are 0/0, they're discarded.
+		return make(_mm_div_ps(lhs.get(), rhs.get()));
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_add_ps(lhs.get(), rhs.get()));
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_sub_ps(lhs.get(), rhs.get()));
+	}
+
+	static inline Simd mul(const Simd &lhs, float rhs) {
+		return make(_mm_mul_ps(lhs.get(), _mm_set1_ps(rhs)));
+	}
+
+	static inline Simd div(const Simd &lhs, float rhs) {
+		return make(_mm_div_ps(lhs.get(), _mm_set1_ps(rhs)));
+	}
+
+	static inline Simd add(const Simd &lhs, float rhs) {
+		return make(_mm_add_ps(lhs.get(), _mm_set1_ps(rhs)));
+	}
+
+	static inline Simd sub(const Simd &lhs, float rhs) {
+		return make(_mm_sub_ps(lhs.get(), _mm_set1_ps(rhs)));
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return make(_mm_add_ps(_mm_mul_ps(a.get(), b.get()), c.get()));
+	}
+
+	static inline Simd spread(float value) {
+		return make(_mm_set1_ps(value));
+	}
+
+	static inline Simd sqrt(const Simd &arg) {
+		return make(_mm_sqrt_ps(arg.get()));
+	}
+
+	/// <summary> The approximate reciprocal of the square root, lane by lane, to within 2.4e-7 relative error. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		// One Newton-Raphson step on the 12 bit estimate: y * (1.5 - 0.5 * x * y * y).
+		const __m128 x = arg.get();
+		const __m128 y = _mm_rsqrt_ps(x);
+		const __m128 halfArg = _mm_mul_ps(_mm_set1_ps(0.5f), x);
+		return make(_mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfArg, _mm_mul_ps(y, y)))));
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		return make(_mm_andnot_ps(signMask, arg.get()));
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		return make(_mm_or_ps(_mm_andnot_ps(signMask, magnitude.get()), _mm_and_ps(signMask, sign.get())));
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		return make(impl::RoundPs(arg.get()));
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		return make(impl::FloorPs(arg.get()));
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	static inline Simd exp2i(const Simd &arg) {
+		return make(impl::Exp2iPs(arg.get()));
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	static inline Simd frexp(const Simd &arg, Simd &exponent) {
+		__m128 exp;
+		const Simd res = make(impl::FrexpPs(arg.get(), exp));
+		exponent = make(exp);
+		return res;
+	}
+
+	/// <summary> Sine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd sin(const Simd &arg) {
+		Simd res, cosine;
+		impl::SimdSinCos(arg, res, cosine);
+		return res;
+	}
+
+	/// <summary> Cosine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd cos(const Simd &arg) {
+		Simd sine, res;
+		impl::SimdSinCos(arg, sine, res);
+		return res;
+	}
+
+	/// <summary> Sine and cosine lane by lane, sharing the range reduction. </summary>
+	static inline void sincos(const Simd &arg, Simd &sine, Simd &cosine) {
+		impl::SimdSinCos(arg, sine, cosine);
+	}
+
+	/// <summary> The angle of the points (x, y) lane by lane, with the accuracy given at impl::SimdAtan2. </summary>
+	static inline Simd atan2(const Simd &y, const Simd &x) {
+		return impl::SimdAtan2(y, x);
+	}
+
+	/// <summary> Arc cosine lane by lane, with the accuracy given at impl::SimdAcos. </summary>
+	static inline Simd acos(const Simd &arg) {
+		return impl::SimdAcos(arg);
+	}
+
+	/// <summary> Exponential function lane by lane, with the accuracy given at impl::SimdExp. </summary>
+	static inline Simd exp(const Simd &arg) {
+		return impl::SimdExp(arg);
+	}
+
+	/// <summary> Natural logarithm lane by lane, with the accuracy given at impl::SimdLog. </summary>
+	static inline Simd log(const Simd &arg) {
+		return impl::SimdLog(arg);
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_min_ps(lhs.get(), rhs.get()));
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_max_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_cmplt_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_cmple_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_cmpeq_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_and_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		return make(_mm_or_ps(lhs.get(), rhs.get()));
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		return make(_mm_xor_ps(arg.get(), _mm_castsi128_ps(_mm_set1_epi32(-1))));
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_ps(arg.get()) & 0b11;
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		const __m128 m = mask.get();
+#if defined(__SSE4_1__) || defined(__AVX__)
+		return make(_mm_blendv_ps(ifFalse.get(), ifTrue.get(), m));
+#else
+		return make(_mm_or_ps(_mm_and_ps(m, ifTrue.get()), _mm_andnot_ps(m, ifFalse.get())));
+#endif
+	}
+
+	static inline Simd set(float x, float y) {
+		Simd res;
+		res.v[0] = x;
+		res.v[1] = y;
+		return res;
+	}
+
+	/// <summary> Loads 2 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const float *ptr) {
+		return make(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr))));
+	}
+
+	/// <summary> Stores the lanes to 2 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(float *ptr, const Simd &arg) {
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), _mm_castps_si128(arg.get()));
+	}
+
+	template<int Count = 2>
+	static inline float dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 2, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		const __m128 prod = _mm_mul_ps(lhs.get(), rhs.get());
+		if constexpr (Count == 1) {
+			return _mm_cvtss_f32(prod);
+		}
+		else {
+			return _mm_cvtss_f32(_mm_add_ss(prod, _mm_shuffle_ps(prod, prod, 1)));
+		}
+	}
+
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count = 2>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 2, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		const __m128 prod = _mm_mul_ps(lhs.get(), rhs.get());
+		if constexpr (Count == 1) {
+			return make(_mm_shuffle_ps(prod, prod, 0));
+		}
+		else {
+			return make(_mm_add_ps(prod, _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(2, 3, 0, 1))));
+		}
+	}
+
+	template<int i0, int i1>
+	static inline Simd shuffle(const Simd &arg) {
+		const __m128 reg = arg.get();
+		return make(_mm_shuffle_ps(reg, reg, _MM_SHUFFLE(3, 2, i0, i1)));
+	}
+};
+
+
 // Specialization for float4, using SSE
 template<>
 union alignas(16) Simd<float, 4> {
@@ -82,382 +475,1685 @@ union alignas(16) Simd<float, 4> {
 		return res;
 	}
 
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg = _mm_sqrt_ps(arg.reg);
+		return res;
+	}
+
+	/// <summary> The approximate reciprocal of the square root, lane by lane, to within 2.4e-7 relative error. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		// One Newton-Raphson step on the 12 bit estimate: y * (1.5 - 0.5 * x * y * y).
+		Simd res;
+		const __m128 y = _mm_rsqrt_ps(arg.reg);
+		const __m128 halfArg = _mm_mul_ps(_mm_set1_ps(0.5f), arg.reg);
+		res.reg = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfArg, _mm_mul_ps(y, y))));
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		res.reg = _mm_andnot_ps(signMask, arg.reg);
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		res.reg = _mm_or_ps(_mm_andnot_ps(signMask, magnitude.reg), _mm_and_ps(signMask, sign.reg));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		res.reg = impl::RoundPs(arg.reg);
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		res.reg = impl::FloorPs(arg.reg);
+		return res;
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	static inline Simd exp2i(const Simd &arg) {
+		Simd res;
+		res.reg = impl::Exp2iPs(arg.reg);
+		return res;
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	static inline Simd frexp(const Simd &arg, Simd &exponent) {
+		Simd res;
+		res.reg = impl::FrexpPs(arg.reg, exponent.reg);
+		return res;
+	}
+
+	/// <summary> Sine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd sin(const Simd &arg) {
+		Simd res, cosine;
+		impl::SimdSinCos(arg, res, cosine);
+		return res;
+	}
+
+	/// <summary> Cosine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd cos(const Simd &arg) {
+		Simd sine, res;
+		impl::SimdSinCos(arg, sine, res);
+		return res;
+	}
+
+	/// <summary> Sine and cosine lane by lane, sharing the range reduction. </summary>
+	static inline void sincos(const Simd &arg, Simd &sine, Simd &cosine) {
+		impl::SimdSinCos(arg, sine, cosine);
+	}
+
+	/// <summary> The angle of the points (x, y) lane by lane, with the accuracy given at impl::SimdAtan2. </summary>
+	static inline Simd atan2(const Simd &y, const Simd &x) {
+		return impl::SimdAtan2(y, x);
+	}
+
+	/// <summary> Arc cosine lane by lane, with the accuracy given at impl::SimdAcos. </summary>
+	static inline Simd acos(const Simd &arg) {
+		return impl::SimdAcos(arg);
+	}
+
+	/// <summary> Exponential function lane by lane, with the accuracy given at impl::SimdExp. </summary>
+	static inline Simd exp(const Simd &arg) {
+		return impl::SimdExp(arg);
+	}
+
+	/// <summary> Natural logarithm lane by lane, with the accuracy given at impl::SimdLog. </summary>
+	static inline Simd log(const Simd &arg) {
+		return impl::SimdLog(arg);
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_min_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_max_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmplt_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmple_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmpeq_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_and_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_or_ps(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		res.reg = _mm_xor_ps(arg.reg, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_ps(arg.reg);
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		Simd res;
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_blendv_ps(ifFalse.reg, ifTrue.reg, mask.reg);
+#else
+		res.reg = _mm_or_ps(_mm_and_ps(mask.reg, ifTrue.reg), _mm_andnot_ps(mask.reg, ifFalse.reg));
+#endif
+		return res;
+	}
+
 	static inline Simd set(float x, float y, float z, float w) {
 		Simd res;
 		res.reg = _mm_setr_ps(x, y, z, w);
 		return res;
 	}
 
+	/// <summary> Loads 4 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const float *ptr) {
+		Simd res;
+		res.reg = _mm_loadu_ps(ptr);
+		return res;
+	}
+
+	/// <summary> Stores the lanes to 4 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(float *ptr, const Simd &arg) {
+		_mm_storeu_ps(ptr, arg.reg);
+	}
+
+	/// <summary> Converts the lanes to <typeparamref name="U"/> like a static_cast, to integers by truncation. </summary>
+	template<class U>
+	static inline Simd<U, 4> convert(const Simd &arg) {
+		Simd<U, 4> res;
+		if constexpr (std::is_same<U, int32_t>::value) {
+			res.reg = _mm_cvttps_epi32(arg.reg);
+		}
+		else {
+			for (int i = 0; i < 4; ++i)
+				res.v[i] = U(arg.v[i]);
+		}
+		return res;
+	}
+
+	/// <summary> Clears the lanes from Count on. </summary>
+	template<int Count>
+	static inline __m128 masked(__m128 arg) {
+		if constexpr (Count < 4) {
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, Count > 1 ? -1 : 0, Count > 2 ? -1 : 0, 0));
+			return _mm_and_ps(arg, mask);
+		}
+		else {
+			return arg;
+		}
+	}
+
 	template<int Count>
 	static inline float dot(const Simd &lhs, const Simd &rhs) {
 		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
 		static_assert(0 < Count, "Count must not be zero.");
-		float sum;
-		Simd m = mul(lhs, rhs);
-		sum = m.v[0];
-		for (int i = 1; i < Count; ++i) {
-			sum += m.v[i];
+		// Horizontal sum in-register, only the first lane is meaningful.
+		// This is cheaper than SSE4.1's _mm_dp_ps, which decodes to more micro-ops.
+		__m128 sum = masked<Count>(_mm_mul_ps(lhs.reg, rhs.reg));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+		return _mm_cvtss_f32(sum);
+	}
+
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	/// <remarks> The sum is shuffled in-register, so there's no round trip through a scalar to broadcast it. </remarks>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		Simd res;
+		const __m128 prod = masked<Count>(_mm_mul_ps(lhs.reg, rhs.reg));
+		res.reg = _mm_add_ps(prod, _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(2, 3, 0, 1)));
+		res.reg = _mm_add_ps(res.reg, _mm_shuffle_ps(res.reg, res.reg, _MM_SHUFFLE(1, 0, 3, 2)));
+		return res;
+	}
+
+	/// <summary> The dot products of the first Count lanes of each lhs with rhs, the i-th in lane i. </summary>
+	/// <remarks> Transposes the four products and adds them up, which takes fewer shuffles than four separate dots. </remarks>
+	template<int Count>
+	static inline Simd dot4(const Simd &lhs0, const Simd &lhs1, const Simd &lhs2, const Simd &lhs3, const Simd &rhs) {
+		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		__m128 p0 = _mm_mul_ps(lhs0.reg, rhs.reg);
+		__m128 p1 = _mm_mul_ps(lhs1.reg, rhs.reg);
+		__m128 p2 = _mm_mul_ps(lhs2.reg, rhs.reg);
+		__m128 p3 = _mm_mul_ps(lhs3.reg, rhs.reg);
+		_MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+		Simd res;
+		res.reg = p0;
+		if constexpr (Count > 1) {
+			res.reg = _mm_add_ps(res.reg, p1);
+		}
+		if constexpr (Count > 2) {
+			res.reg = _mm_add_ps(res.reg, p2);
+		}
+		if constexpr (Count > 3) {
+			res.reg = _mm_add_ps(res.reg, p3);
+		}
+		return res;
+	}
+
+	template<int i0, int i1, int i2, int i3>
+	static inline Simd shuffle(const Simd &arg) {
+		Simd ret;
+		ret.regi = _mm_shuffle_epi32(arg.regi, _MM_SHUFFLE(i0, i1, i2, i3));
+		return ret;
+	}
+};
+
+
+// Specialization for float8, using SSE
+// With AVX, Simd_AVX.hpp provides it instead.
+#if !defined(__AVX__)
+template<>
+union alignas(16) Simd<float, 8> {
+	__m128 reg[2];
+	float v[8];
+
+
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_mul_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_mul_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_div_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_div_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_add_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_add_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_sub_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_sub_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd mul(const Simd &lhs, float rhs) {
+		Simd res;
+		__m128 tmp = _mm_set1_ps(rhs);
+		res.reg[0] = _mm_mul_ps(lhs.reg[0], tmp);
+		res.reg[1] = _mm_mul_ps(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, float rhs) {
+		Simd res;
+		__m128 tmp = _mm_set1_ps(rhs);
+		res.reg[0] = _mm_div_ps(lhs.reg[0], tmp);
+		res.reg[1] = _mm_div_ps(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, float rhs) {
+		Simd res;
+		__m128 tmp = _mm_set1_ps(rhs);
+		res.reg[0] = _mm_add_ps(lhs.reg[0], tmp);
+		res.reg[1] = _mm_add_ps(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, float rhs) {
+		Simd res;
+		__m128 tmp = _mm_set1_ps(rhs);
+		res.reg[0] = _mm_sub_ps(lhs.reg[0], tmp);
+		res.reg[1] = _mm_sub_ps(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(float value) {
+		Simd res;
+		res.reg[0] = _mm_set1_ps(value);
+		res.reg[1] = _mm_set1_ps(value);
+		return res;
+	}
+
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg[0] = _mm_sqrt_ps(arg.reg[0]);
+		res.reg[1] = _mm_sqrt_ps(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> The approximate reciprocal of the square root, lane by lane, to within 2.4e-7 relative error. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		// One Newton-Raphson step on the 12 bit estimate: y * (1.5 - 0.5 * x * y * y).
+		Simd res;
+		for (int i = 0; i < 2; ++i) {
+			const __m128 y = _mm_rsqrt_ps(arg.reg[i]);
+			const __m128 halfArg = _mm_mul_ps(_mm_set1_ps(0.5f), arg.reg[i]);
+			res.reg[i] = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfArg, _mm_mul_ps(y, y))));
+		}
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		res.reg[0] = _mm_andnot_ps(signMask, arg.reg[0]);
+		res.reg[1] = _mm_andnot_ps(signMask, arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		res.reg[0] = _mm_or_ps(_mm_andnot_ps(signMask, magnitude.reg[0]), _mm_and_ps(signMask, sign.reg[0]));
+		res.reg[1] = _mm_or_ps(_mm_andnot_ps(signMask, magnitude.reg[1]), _mm_and_ps(signMask, sign.reg[1]));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		res.reg[0] = impl::RoundPs(arg.reg[0]);
+		res.reg[1] = impl::RoundPs(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		res.reg[0] = impl::FloorPs(arg.reg[0]);
+		res.reg[1] = impl::FloorPs(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> 2 to the power of the integers in the lanes, which must be in [-126, 127]. </summary>
+	static inline Simd exp2i(const Simd &arg) {
+		Simd res;
+		res.reg[0] = impl::Exp2iPs(arg.reg[0]);
+		res.reg[1] = impl::Exp2iPs(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> Splits normal, non-zero numbers into a mantissa in [0.5, 1) with the sign of the number, and an exponent of 2. </summary>
+	static inline Simd frexp(const Simd &arg, Simd &exponent) {
+		Simd res;
+		res.reg[0] = impl::FrexpPs(arg.reg[0], exponent.reg[0]);
+		res.reg[1] = impl::FrexpPs(arg.reg[1], exponent.reg[1]);
+		return res;
+	}
+
+	/// <summary> Sine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd sin(const Simd &arg) {
+		Simd res, cosine;
+		impl::SimdSinCos(arg, res, cosine);
+		return res;
+	}
+
+	/// <summary> Cosine lane by lane, with the accuracy given at impl::SimdSinCos. </summary>
+	static inline Simd cos(const Simd &arg) {
+		Simd sine, res;
+		impl::SimdSinCos(arg, sine, res);
+		return res;
+	}
+
+	/// <summary> Sine and cosine lane by lane, sharing the range reduction. </summary>
+	static inline void sincos(const Simd &arg, Simd &sine, Simd &cosine) {
+		impl::SimdSinCos(arg, sine, cosine);
+	}
+
+	/// <summary> The angle of the points (x, y) lane by lane, with the accuracy given at impl::SimdAtan2. </summary>
+	static inline Simd atan2(const Simd &y, const Simd &x) {
+		return impl::SimdAtan2(y, x);
+	}
+
+	/// <summary> Arc cosine lane by lane, with the accuracy given at impl::SimdAcos. </summary>
+	static inline Simd acos(const Simd &arg) {
+		return impl::SimdAcos(arg);
+	}
+
+	/// <summary> Exponential function lane by lane, with the accuracy given at impl::SimdExp. </summary>
+	static inline Simd exp(const Simd &arg) {
+		return impl::SimdExp(arg);
+	}
+
+	/// <summary> Natural logarithm lane by lane, with the accuracy given at impl::SimdLog. </summary>
+	static inline Simd log(const Simd &arg) {
+		return impl::SimdLog(arg);
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_min_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_min_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_max_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_max_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmplt_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmplt_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmple_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmple_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmpeq_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmpeq_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_and_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_and_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_or_ps(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_or_ps(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		const __m128 ones = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		res.reg[0] = _mm_xor_ps(arg.reg[0], ones);
+		res.reg[1] = _mm_xor_ps(arg.reg[1], ones);
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_ps(arg.reg[0]) | (_mm_movemask_ps(arg.reg[1]) << 4);
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		Simd res;
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg[0] = _mm_blendv_ps(ifFalse.reg[0], ifTrue.reg[0], mask.reg[0]);
+		res.reg[1] = _mm_blendv_ps(ifFalse.reg[1], ifTrue.reg[1], mask.reg[1]);
+#else
+		res.reg[0] = _mm_or_ps(_mm_and_ps(mask.reg[0], ifTrue.reg[0]), _mm_andnot_ps(mask.reg[0], ifFalse.reg[0]));
+		res.reg[1] = _mm_or_ps(_mm_and_ps(mask.reg[1], ifTrue.reg[1]), _mm_andnot_ps(mask.reg[1], ifFalse.reg[1]));
+#endif
+		return res;
+	}
+
+	static inline Simd set(float a, float b, float c, float d, float e, float f, float g, float h) {
+		Simd res;
+		res.reg[0] = _mm_setr_ps(a, b, c, d);
+		res.reg[1] = _mm_setr_ps(e, f, g, h);
+		return res;
+	}
+
+	/// <summary> Loads 8 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const float *ptr) {
+		Simd res;
+		res.reg[0] = _mm_loadu_ps(ptr);
+		res.reg[1] = _mm_loadu_ps(ptr + 4);
+		return res;
+	}
+
+	/// <summary> Stores the lanes to 8 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(float *ptr, const Simd &arg) {
+		_mm_storeu_ps(ptr, arg.reg[0]);
+		_mm_storeu_ps(ptr + 4, arg.reg[1]);
+	}
+
+
+	template<int Count>
+	static inline float dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 8, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		__m128 reg1, reg2;
+		reg1 = _mm_mul_ps(lhs.reg[0], rhs.reg[0]);
+		reg2 = _mm_mul_ps(lhs.reg[1], rhs.reg[1]);
+
+		for (int i = 7; i >= Count && i >= 4; --i) {
+			reinterpret_cast<float *>(&reg2)[i] = 0.0f;
+		}
+		for (int i = 3; i >= Count && i >= 0; --i) {
+			reinterpret_cast<float *>(&reg1)[i] = 0.0f;
+		}
+
+		float sum;
+		reg1 = _mm_add_ps(reg1, reg2);
+		sum = reinterpret_cast<float *>(&reg1)[0]
+		      + reinterpret_cast<float *>(&reg1)[1]
+		      + reinterpret_cast<float *>(&reg1)[2]
+		      + reinterpret_cast<float *>(&reg1)[3];
+
+		return sum;
+	}
+
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
+
+
+	template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+	static inline Simd shuffle(const Simd &arg) {
+		Simd ret;
+		ret.v[7] = arg.v[i0];
+		ret.v[6] = arg.v[i1];
+		ret.v[5] = arg.v[i2];
+		ret.v[4] = arg.v[i3];
+		ret.v[3] = arg.v[i4];
+		ret.v[2] = arg.v[i5];
+		ret.v[1] = arg.v[i6];
+		ret.v[0] = arg.v[i7];
+		return ret;
+	}
+};
+#endif
+
+
+//------------------------------------------------------------------------------
+// DOUBLE
+//------------------------------------------------------------------------------
+
+
+
+// Specialization for double2, using SSE
+template<>
+union alignas(16) Simd<double, 2> {
+	__m128d reg;
+	double v[4];
+
+
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_mul_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_div_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_add_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_sub_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd mul(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg = _mm_mul_pd(lhs.reg, tmp);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg = _mm_div_pd(lhs.reg, tmp);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg = _mm_add_pd(lhs.reg, tmp);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg = _mm_sub_pd(lhs.reg, tmp);
+		return res;
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(double value) {
+		Simd res;
+		res.reg = _mm_set1_pd(value);
+		return res;
+	}
+
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg = _mm_sqrt_pd(arg.reg);
+		return res;
+	}
+
+	/// <summary> The reciprocal of the square root, lane by lane. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		Simd res;
+		res.reg = _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(arg.reg));
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		res.reg = _mm_andnot_pd(signMask, arg.reg);
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		res.reg = _mm_or_pd(_mm_andnot_pd(signMask, magnitude.reg), _mm_and_pd(signMask, sign.reg));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		res.reg = impl::RoundPd(arg.reg);
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		res.reg = impl::FloorPd(arg.reg);
+		return res;
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_min_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_max_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmplt_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmple_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_cmpeq_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_and_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_or_pd(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		res.reg = _mm_xor_pd(arg.reg, _mm_castsi128_pd(_mm_set1_epi32(-1)));
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_pd(arg.reg);
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		Simd res;
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_blendv_pd(ifFalse.reg, ifTrue.reg, mask.reg);
+#else
+		res.reg = _mm_or_pd(_mm_and_pd(mask.reg, ifTrue.reg), _mm_andnot_pd(mask.reg, ifFalse.reg));
+#endif
+		return res;
+	}
+
+	static inline Simd set(double x, double y) {
+		Simd res;
+		res.reg = _mm_setr_pd(x, y);
+		return res;
+	}
+
+	/// <summary> Loads 2 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const double *ptr) {
+		Simd res;
+		res.reg = _mm_loadu_pd(ptr);
+		return res;
+	}
+
+	/// <summary> Stores the lanes to 2 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(double *ptr, const Simd &arg) {
+		_mm_storeu_pd(ptr, arg.reg);
+	}
+
+	template<int Count>
+	static inline double dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 2, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		double sum;
+		Simd m = mul(lhs, rhs);
+		sum = m.v[0];
+		for (int i = 1; i < Count; ++i) {
+			sum += m.v[i];
+		}
+		return sum;
+	}
+
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
+
+	template<int i0, int i1>
+	static inline Simd shuffle(const Simd &arg) {
+		Simd ret;
+		ret.reg = _mm_shuffle_pd(arg.reg, arg.reg, _MM_SHUFFLE2(i0, i1));
+		return ret;
+	}
+};
+
+
+// Specialization for double4, using SSE
+//*
+template<>
+union alignas(16) Simd<double, 4> {
+	__m128d reg[2];
+	double v[4];
+
+
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_mul_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_mul_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_div_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_div_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_add_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_add_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_sub_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_sub_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd mul(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg[0] = _mm_mul_pd(lhs.reg[0], tmp);
+		res.reg[1] = _mm_mul_pd(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd div(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg[0] = _mm_div_pd(lhs.reg[0], tmp);
+		res.reg[1] = _mm_div_pd(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg[0] = _mm_add_pd(lhs.reg[0], tmp);
+		res.reg[1] = _mm_add_pd(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, double rhs) {
+		Simd res;
+		__m128d tmp = _mm_set1_pd(rhs);
+		res.reg[0] = _mm_sub_pd(lhs.reg[0], tmp);
+		res.reg[1] = _mm_sub_pd(lhs.reg[1], tmp);
+		return res;
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(double value) {
+		Simd res;
+		res.reg[0] = _mm_set1_pd(value);
+		res.reg[1] = _mm_set1_pd(value);
+		return res;
+	}
+
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg[0] = _mm_sqrt_pd(arg.reg[0]);
+		res.reg[1] = _mm_sqrt_pd(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> The reciprocal of the square root, lane by lane. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		Simd res;
+		res.reg[0] = _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(arg.reg[0]));
+		res.reg[1] = _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(arg.reg[1]));
+		return res;
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		res.reg[0] = _mm_andnot_pd(signMask, arg.reg[0]);
+		res.reg[1] = _mm_andnot_pd(signMask, arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m128d signMask = _mm_set1_pd(-0.0);
+		res.reg[0] = _mm_or_pd(_mm_andnot_pd(signMask, magnitude.reg[0]), _mm_and_pd(signMask, sign.reg[0]));
+		res.reg[1] = _mm_or_pd(_mm_andnot_pd(signMask, magnitude.reg[1]), _mm_and_pd(signMask, sign.reg[1]));
+		return res;
+	}
+
+	/// <summary> Rounds to the nearest integer lane by lane, halfway cases to even. </summary>
+	static inline Simd round(const Simd &arg) {
+		Simd res;
+		res.reg[0] = impl::RoundPd(arg.reg[0]);
+		res.reg[1] = impl::RoundPd(arg.reg[1]);
+		return res;
+	}
+
+	/// <summary> Rounds towards negative infinity, lane by lane. </summary>
+	static inline Simd floor(const Simd &arg) {
+		Simd res;
+		res.reg[0] = impl::FloorPd(arg.reg[0]);
+		res.reg[1] = impl::FloorPd(arg.reg[1]);
+		return res;
+	}
+
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_min_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_min_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_max_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_max_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmplt_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmplt_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmple_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmple_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_cmpeq_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_cmpeq_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_and_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_and_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg[0] = _mm_or_pd(lhs.reg[0], rhs.reg[0]);
+		res.reg[1] = _mm_or_pd(lhs.reg[1], rhs.reg[1]);
+		return res;
+	}
+
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
+		Simd res;
+		const __m128d ones = _mm_castsi128_pd(_mm_set1_epi32(-1));
+		res.reg[0] = _mm_xor_pd(arg.reg[0], ones);
+		res.reg[1] = _mm_xor_pd(arg.reg[1], ones);
+		return res;
+	}
+
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_pd(arg.reg[0]) | (_mm_movemask_pd(arg.reg[1]) << 2);
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
+		Simd res;
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg[0] = _mm_blendv_pd(ifFalse.reg[0], ifTrue.reg[0], mask.reg[0]);
+		res.reg[1] = _mm_blendv_pd(ifFalse.reg[1], ifTrue.reg[1], mask.reg[1]);
+#else
+		res.reg[0] = _mm_or_pd(_mm_and_pd(mask.reg[0], ifTrue.reg[0]), _mm_andnot_pd(mask.reg[0], ifFalse.reg[0]));
+		res.reg[1] = _mm_or_pd(_mm_and_pd(mask.reg[1], ifTrue.reg[1]), _mm_andnot_pd(mask.reg[1], ifFalse.reg[1]));
+#endif
+		return res;
+	}
+
+	static inline Simd set(double x, double y, double z, double w) {
+		Simd res;
+		res.reg[0] = _mm_setr_pd(x, y);
+		res.reg[1] = _mm_setr_pd(z, w);
+		return res;
+	}
+
+	/// <summary> Loads 4 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const double *ptr) {
+		Simd res;
+		res.reg[0] = _mm_loadu_pd(ptr);
+		res.reg[1] = _mm_loadu_pd(ptr + 2);
+		return res;
+	}
+
+	/// <summary> Stores the lanes to 4 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(double *ptr, const Simd &arg) {
+		_mm_storeu_pd(ptr, arg.reg[0]);
+		_mm_storeu_pd(ptr + 2, arg.reg[1]);
+	}
+
+
+	template<int Count>
+	static inline double dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		__m128d regs[2];
+		regs[0] = _mm_mul_pd(lhs.reg[0], rhs.reg[0]);
+		regs[1] = _mm_mul_pd(lhs.reg[1], rhs.reg[1]);
+
+		for (int i = 3; i >= Count; --i) {
+			reinterpret_cast<double *>(&regs)[i] = 0.0;
 		}
+
+		double sum;
+		regs[0] = _mm_add_pd(regs[0], regs[1]);
+		sum = reinterpret_cast<double *>(&regs[0])[0] + reinterpret_cast<double *>(&regs[0])[1];
+
 		return sum;
 	}
 
-	template<int i0, int i1, int i2, int i3>
-	static inline Simd shuffle(const Simd &arg) {
-		Simd ret;
-		ret.regi = _mm_shuffle_epi32(arg.regi, _MM_SHUFFLE(i0, i1, i2, i3));
-		return ret;
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
+
+	/// <summary> The dot products of the first Count lanes of each lhs with rhs, the i-th in lane i. </summary>
+	template<int Count>
+	static inline Simd dot4(const Simd &lhs0, const Simd &lhs1, const Simd &lhs2, const Simd &lhs3, const Simd &rhs) {
+		return set(dot<Count>(lhs0, rhs), dot<Count>(lhs1, rhs), dot<Count>(lhs2, rhs), dot<Count>(lhs3, rhs));
+	}
+
+
+	template<int i0, int i1, int i2, int i3>
+	static inline Simd shuffle(const Simd &arg) {
+		Simd ret;
+		ret.v[3] = arg.v[i0];
+		ret.v[2] = arg.v[i1];
+		ret.v[1] = arg.v[i2];
+		ret.v[0] = arg.v[i3];
+		return ret;
+	}
+};
+//*/
+
+
+//------------------------------------------------------------------------------
+// INT
+//------------------------------------------------------------------------------
+
+// Specialization for int4, using SSE2, and SSE4.1 where available
+template<>
+union alignas(16) Simd<int32_t, 4> {
+	__m128i reg;
+	int32_t v[4];
+
+
+	/// <summary> The low 32 bits of the products, lane by lane. </summary>
+	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = impl::MulloEpi32(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <summary> Divides lane by lane, truncating towards zero. </summary>
+	/// <remarks> Goes through doubles, so a zero divisor, like in the padding lane of 3-element vectors, doesn't trap. </remarks>
+	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = impl::DivEpi32(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_add_epi32(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+		Simd res;
+		res.reg = _mm_sub_epi32(lhs.reg, rhs.reg);
+		return res;
+	}
+
+	/// <remarks> Floating point factors are applied in floating point and truncated, the same as for scalars. </remarks>
+	template<class U>
+	static inline Simd mul(const Simd &lhs, U rhs) {
+		if constexpr (std::is_floating_point<U>::value) {
+			return lanes(lhs, [rhs](int32_t value) { return value * rhs; });
+		}
+		else {
+			return mul(lhs, spread(int32_t(rhs)));
+		}
+	}
+
+	/// <remarks> Floating point divisors are applied in floating point and truncated, the same as for scalars. </remarks>
+	template<class U>
+	static inline Simd div(const Simd &lhs, U rhs) {
+		if constexpr (std::is_floating_point<U>::value) {
+			return lanes(lhs, [rhs](int32_t value) { return value / rhs; });
+		}
+		else {
+			return div(lhs, spread(int32_t(rhs)));
+		}
+	}
+
+	template<class U>
+	static inline Simd add(const Simd &lhs, U rhs) {
+		if constexpr (std::is_floating_point<U>::value) {
+			return lanes(lhs, [rhs](int32_t value) { return value + rhs; });
+		}
+		else {
+			return add(lhs, spread(int32_t(rhs)));
+		}
+	}
+
+	template<class U>
+	static inline Simd sub(const Simd &lhs, U rhs) {
+		if constexpr (std::is_floating_point<U>::value) {
+			return lanes(lhs, [rhs](int32_t value) { return value - rhs; });
+		}
+		else {
+			return sub(lhs, spread(int32_t(rhs)));
+		}
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(int32_t value) {
+		Simd res;
+		res.reg = _mm_set1_epi32(value);
+		return res;
+	}
+
+	/// <summary> The square roots lane by lane, truncated towards zero. </summary>
+	static inline Simd sqrt(const Simd &arg) {
+		Simd res;
+		res.reg = impl::SqrtEpi32(arg.reg);
+		return res;
+	}
+
+	/// <summary> The reciprocal of the square root lane by lane, truncated towards zero. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		return div(spread(1), sqrt(arg));
+	}
+
+	static inline Simd abs(const Simd &arg) {
+		Simd res;
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_abs_epi32(arg.reg);
+#else
+		const __m128i sign = _mm_srai_epi32(arg.reg, 31);
+		res.reg = _mm_sub_epi32(_mm_xor_si128(arg.reg, sign), sign);
+#endif
+		return res;
+	}
+
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
+		Simd res;
+		const __m128i negative = _mm_srai_epi32(sign.reg, 31);
+		res.reg = _mm_sub_epi32(_mm_xor_si128(abs(magnitude).reg, negative), negative);
+		return res;
 	}
-};
 
+	/// <summary> Integers are already rounded. </summary>
+	static inline Simd round(const Simd &arg) {
+		return arg;
+	}
 
-// Specialization for float8, using SSE
-template<>
-union alignas(16) Simd<float, 8> {
-	__m128 reg[2];
-	float v[8];
+	/// <summary> Integers are already rounded. </summary>
+	static inline Simd floor(const Simd &arg) {
+		return arg;
+	}
 
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+#if defined(__SSE4_1__) || defined(__AVX__)
+		Simd res;
+		res.reg = _mm_min_epi32(lhs.reg, rhs.reg);
+		return res;
+#else
+		return select(less(lhs, rhs), lhs, rhs);
+#endif
+	}
 
-	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+#if defined(__SSE4_1__) || defined(__AVX__)
 		Simd res;
-		res.reg[0] = _mm_mul_ps(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_mul_ps(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_max_epi32(lhs.reg, rhs.reg);
 		return res;
+#else
+		return select(less(lhs, rhs), rhs, lhs);
+#endif
 	}
 
-	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_div_ps(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_div_ps(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_cmplt_epi32(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_add_ps(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_add_ps(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_xor_si128(_mm_cmpgt_epi32(lhs.reg, rhs.reg), _mm_set1_epi32(-1));
 		return res;
 	}
 
-	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_sub_ps(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_sub_ps(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_cmpeq_epi32(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd mul(const Simd &lhs, float rhs) {
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		__m128 tmp = _mm_set1_ps(rhs);
-		res.reg[0] = _mm_mul_ps(lhs.reg[0], tmp);
-		res.reg[1] = _mm_mul_ps(lhs.reg[1], tmp);
+		res.reg = _mm_and_si128(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd div(const Simd &lhs, float rhs) {
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		__m128 tmp = _mm_set1_ps(rhs);
-		res.reg[0] = _mm_div_ps(lhs.reg[0], tmp);
-		res.reg[1] = _mm_div_ps(lhs.reg[1], tmp);
+		res.reg = _mm_or_si128(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd add(const Simd &lhs, float rhs) {
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
 		Simd res;
-		__m128 tmp = _mm_set1_ps(rhs);
-		res.reg[0] = _mm_add_ps(lhs.reg[0], tmp);
-		res.reg[1] = _mm_add_ps(lhs.reg[1], tmp);
+		res.reg = _mm_xor_si128(arg.reg, _mm_set1_epi32(-1));
 		return res;
 	}
 
-	static inline Simd sub(const Simd &lhs, float rhs) {
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_ps(_mm_castsi128_ps(arg.reg));
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
 		Simd res;
-		__m128 tmp = _mm_set1_ps(rhs);
-		res.reg[0] = _mm_sub_ps(lhs.reg[0], tmp);
-		res.reg[1] = _mm_sub_ps(lhs.reg[1], tmp);
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_blendv_epi8(ifFalse.reg, ifTrue.reg, mask.reg);
+#else
+		res.reg = _mm_or_si128(_mm_and_si128(mask.reg, ifTrue.reg), _mm_andnot_si128(mask.reg, ifFalse.reg));
+#endif
 		return res;
 	}
 
-	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
-		return add(mul(a, b), c);
+	/// <summary> Shifts the bits of each lane left by <paramref name="count"/>. </summary>
+	static inline Simd shiftLeft(const Simd &arg, int count) {
+		Simd res;
+		res.reg = _mm_sll_epi32(arg.reg, _mm_cvtsi32_si128(count));
+		return res;
 	}
 
-	static inline Simd spread(float value) {
+	/// <summary> Shifts the bits of each lane right by <paramref name="count"/>, copying the sign bit. </summary>
+	static inline Simd shiftRight(const Simd &arg, int count) {
 		Simd res;
-		res.reg[0] = _mm_set1_ps(value);
-		res.reg[1] = _mm_set1_ps(value);
+		res.reg = _mm_sra_epi32(arg.reg, _mm_cvtsi32_si128(count));
 		return res;
 	}
 
-	static inline Simd set(float a, float b, float c, float d, float e, float f, float g, float h) {
+	static inline Simd set(int32_t x, int32_t y, int32_t z, int32_t w) {
 		Simd res;
-		res.reg[0] = _mm_setr_ps(a, b, c, d);
-		res.reg[1] = _mm_setr_ps(e, f, g, h);
+		res.reg = _mm_setr_epi32(x, y, z, w);
 		return res;
 	}
 
+	/// <summary> Loads 4 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const int32_t *ptr) {
+		Simd res;
+		res.reg = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		return res;
+	}
 
-	template<int Count>
-	static inline float dot(const Simd &lhs, const Simd &rhs) {
-		static_assert(Count <= 8, "Number of elements to dot must be smaller or equal to dimension.");
-		static_assert(0 < Count, "Count must not be zero.");
-		__m128 reg1, reg2;
-		reg1 = _mm_mul_ps(lhs.reg[0], rhs.reg[0]);
-		reg2 = _mm_mul_ps(lhs.reg[1], rhs.reg[1]);
+	/// <summary> Stores the lanes to 4 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(int32_t *ptr, const Simd &arg) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), arg.reg);
+	}
 
-		for (int i = 7; i >= Count && i >= 4; --i) {
-			reinterpret_cast<float *>(&reg2)[i] = 0.0f;
+	/// <summary> Converts the lanes to <typeparamref name="U"/> like a static_cast. </summary>
+	template<class U>
+	static inline Simd<U, 4> convert(const Simd &arg) {
+		Simd<U, 4> res;
+		if constexpr (std::is_same<U, float>::value) {
+			res.reg = _mm_cvtepi32_ps(arg.reg);
 		}
-		for (int i = 3; i >= Count && i >= 0; --i) {
-			reinterpret_cast<float *>(&reg1)[i] = 0.0f;
+		else {
+			for (int i = 0; i < 4; ++i)
+				res.v[i] = U(arg.v[i]);
 		}
+		return res;
+	}
 
-		float sum;
-		reg1 = _mm_add_ps(reg1, reg2);
-		sum = reinterpret_cast<float *>(&reg1)[0]
-		      + reinterpret_cast<float *>(&reg1)[1]
-		      + reinterpret_cast<float *>(&reg1)[2]
-		      + reinterpret_cast<float *>(&reg1)[3];
+	/// <summary> Clears the lanes from Count on. </summary>
+	template<int Count>
+	static inline __m128i masked(__m128i arg) {
+		if constexpr (Count < 4) {
+			return _mm_and_si128(arg, _mm_setr_epi32(-1, Count > 1 ? -1 : 0, Count > 2 ? -1 : 0, 0));
+		}
+		else {
+			return arg;
+		}
+	}
 
-		return sum;
+	template<int Count>
+	static inline int32_t dot(const Simd &lhs, const Simd &rhs) {
+		return _mm_cvtsi128_si32(dotSpread<Count>(lhs, rhs).reg);
 	}
 
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		Simd res;
+		const __m128i prod = masked<Count>(impl::MulloEpi32(lhs.reg, rhs.reg));
+		res.reg = _mm_add_epi32(prod, _mm_shuffle_epi32(prod, _MM_SHUFFLE(2, 3, 0, 1)));
+		res.reg = _mm_add_epi32(res.reg, _mm_shuffle_epi32(res.reg, _MM_SHUFFLE(1, 0, 3, 2)));
+		return res;
+	}
 
-	template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+	/// <summary> The dot products of the first Count lanes of each lhs with rhs, the i-th in lane i. </summary>
+	template<int Count>
+	static inline Simd dot4(const Simd &lhs0, const Simd &lhs1, const Simd &lhs2, const Simd &lhs3, const Simd &rhs) {
+		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+		static_assert(0 < Count, "Count must not be zero.");
+		const __m128i p0 = impl::MulloEpi32(lhs0.reg, rhs.reg);
+		const __m128i p1 = impl::MulloEpi32(lhs1.reg, rhs.reg);
+		const __m128i p2 = impl::MulloEpi32(lhs2.reg, rhs.reg);
+		const __m128i p3 = impl::MulloEpi32(lhs3.reg, rhs.reg);
+		// Transpose, each of the final unpacks gathers the same lane of all four products.
+		const __m128i low01 = _mm_unpacklo_epi32(p0, p1);
+		const __m128i low23 = _mm_unpacklo_epi32(p2, p3);
+		const __m128i high01 = _mm_unpackhi_epi32(p0, p1);
+		const __m128i high23 = _mm_unpackhi_epi32(p2, p3);
+		Simd res;
+		res.reg = _mm_unpacklo_epi64(low01, low23);
+		if constexpr (Count > 1) {
+			res.reg = _mm_add_epi32(res.reg, _mm_unpackhi_epi64(low01, low23));
+		}
+		if constexpr (Count > 2) {
+			res.reg = _mm_add_epi32(res.reg, _mm_unpacklo_epi64(high01, high23));
+		}
+		if constexpr (Count > 3) {
+			res.reg = _mm_add_epi32(res.reg, _mm_unpackhi_epi64(high01, high23));
+		}
+		return res;
+	}
+
+	template<int i0, int i1, int i2, int i3>
 	static inline Simd shuffle(const Simd &arg) {
 		Simd ret;
-		ret.v[7] = arg.v[i0];
-		ret.v[6] = arg.v[i1];
-		ret.v[5] = arg.v[i2];
-		ret.v[4] = arg.v[i3];
-		ret.v[3] = arg.v[i4];
-		ret.v[2] = arg.v[i5];
-		ret.v[1] = arg.v[i6];
-		ret.v[0] = arg.v[i7];
+		ret.reg = _mm_shuffle_epi32(arg.reg, _MM_SHUFFLE(i0, i1, i2, i3));
 		return ret;
 	}
-};
-
-
-//------------------------------------------------------------------------------
-// DOUBLE
-//------------------------------------------------------------------------------
 
+private:
+	template<class Op>
+	static inline Simd lanes(const Simd &arg, Op op) {
+		Simd res;
+		for (int i = 0; i < 4; ++i)
+			res.v[i] = int32_t(op(arg.v[i]));
+		return res;
+	}
+};
 
 
-// Specialization for double2, using SSE
+// Specialization for int2 with 64 bit lanes, using SSE2, and SSE4.1/4.2 where available
 template<>
-union alignas(16) Simd<double, 2> {
-	__m128d reg;
-	double v[4];
+union alignas(16) Simd<int64_t, 2> {
+	__m128i reg;
+	int64_t v[2];
 
 
+	/// <summary> The low 64 bits of the products, lane by lane. </summary>
 	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg = _mm_mul_pd(lhs.reg, rhs.reg);
+		res.reg = impl::MulloEpi64(lhs.reg, rhs.reg);
 		return res;
 	}
 
+	/// <summary> Divides lane by lane, truncating towards zero. </summary>
+	/// <remarks> There's no SIMD division for 64 bit integers, this divides the lanes one by one. </remarks>
 	static inline Simd div(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg = _mm_div_pd(lhs.reg, rhs.reg);
+		res.v[0] = lhs.v[0] / rhs.v[0];
+		res.v[1] = lhs.v[1] / rhs.v[1];
 		return res;
 	}
 
 	static inline Simd add(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg = _mm_add_pd(lhs.reg, rhs.reg);
+		res.reg = _mm_add_epi64(lhs.reg, rhs.reg);
 		return res;
 	}
 
 	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg = _mm_sub_pd(lhs.reg, rhs.reg);
+		res.reg = _mm_sub_epi64(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd mul(const Simd &lhs, double rhs) {
-		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg = _mm_mul_pd(lhs.reg, tmp);
-		return res;
+	static inline Simd mul(const Simd &lhs, int64_t rhs) {
+		return mul(lhs, spread(rhs));
 	}
 
-	static inline Simd div(const Simd &lhs, double rhs) {
-		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg = _mm_div_pd(lhs.reg, tmp);
-		return res;
+	static inline Simd div(const Simd &lhs, int64_t rhs) {
+		return div(lhs, spread(rhs));
 	}
 
-	static inline Simd add(const Simd &lhs, double rhs) {
+	static inline Simd add(const Simd &lhs, int64_t rhs) {
+		return add(lhs, spread(rhs));
+	}
+
+	static inline Simd sub(const Simd &lhs, int64_t rhs) {
+		return sub(lhs, spread(rhs));
+	}
+
+	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
+		return add(mul(a, b), c);
+	}
+
+	static inline Simd spread(int64_t value) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg = _mm_add_pd(lhs.reg, tmp);
+		res.reg = _mm_set1_epi64x(value);
 		return res;
 	}
 
-	static inline Simd sub(const Simd &lhs, double rhs) {
+	/// <summary> The square roots lane by lane, truncated towards zero. </summary>
+	static inline Simd sqrt(const Simd &arg) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg = _mm_sub_pd(lhs.reg, tmp);
+		res.v[0] = int64_t(std::sqrt(arg.v[0]));
+		res.v[1] = int64_t(std::sqrt(arg.v[1]));
 		return res;
 	}
 
-	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
-		return add(mul(a, b), c);
+	/// <summary> The reciprocal of the square root lane by lane, truncated towards zero. </summary>
+	static inline Simd rsqrt(const Simd &arg) {
+		return div(spread(1), sqrt(arg));
 	}
 
-	static inline Simd spread(double value) {
+	static inline Simd abs(const Simd &arg) {
 		Simd res;
-		res.reg = _mm_set1_pd(value);
+		const __m128i sign = impl::SignEpi64(arg.reg);
+		res.reg = _mm_sub_epi64(_mm_xor_si128(arg.reg, sign), sign);
 		return res;
 	}
 
-	static inline Simd set(double x, double y) {
+	/// <summary> The magnitude of <paramref name="magnitude"/> with the sign of <paramref name="sign"/>, lane by lane. </summary>
+	static inline Simd copysign(const Simd &magnitude, const Simd &sign) {
 		Simd res;
-		res.reg = _mm_setr_pd(x, y);
+		const __m128i negative = impl::SignEpi64(sign.reg);
+		res.reg = _mm_sub_epi64(_mm_xor_si128(abs(magnitude).reg, negative), negative);
 		return res;
 	}
 
-	template<int Count>
-	static inline double dot(const Simd &lhs, const Simd &rhs) {
-		static_assert(Count <= 2, "Number of elements to dot must be smaller or equal to dimension.");
-		static_assert(0 < Count, "Count must not be zero.");
-		double sum;
-		Simd m = mul(lhs, rhs);
-		sum = m.v[0];
-		for (int i = 1; i < Count; ++i) {
-			sum += m.v[i];
-		}
-		return sum;
+	/// <summary> Integers are already rounded. </summary>
+	static inline Simd round(const Simd &arg) {
+		return arg;
 	}
 
-	template<int i0, int i1>
-	static inline Simd shuffle(const Simd &arg) {
-		Simd ret;
-		ret.reg = _mm_shuffle_pd(arg.reg, arg.reg, _MM_SHUFFLE2(i0, i1));
-		return ret;
+	/// <summary> Integers are already rounded. </summary>
+	static inline Simd floor(const Simd &arg) {
+		return arg;
 	}
-};
-
 
-// Specialization for double4, using SSE
-//*
-template<>
-union alignas(16) Simd<double, 4> {
-	__m128d reg[2];
-	double v[4];
+	static inline Simd min(const Simd &lhs, const Simd &rhs) {
+		return select(less(lhs, rhs), lhs, rhs);
+	}
 
+	static inline Simd max(const Simd &lhs, const Simd &rhs) {
+		return select(less(lhs, rhs), rhs, lhs);
+	}
 
-	static inline Simd mul(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs is less than rhs, and cleared elsewhere. </summary>
+	static inline Simd less(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_mul_pd(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_mul_pd(lhs.reg[1], rhs.reg[1]);
+		res.reg = impl::CmpgtEpi64(rhs.reg, lhs.reg);
 		return res;
 	}
 
-	static inline Simd div(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs is less than or equal to rhs, and cleared elsewhere. </summary>
+	static inline Simd lessEqual(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_div_pd(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_div_pd(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_xor_si128(impl::CmpgtEpi64(lhs.reg, rhs.reg), _mm_set1_epi32(-1));
 		return res;
 	}
 
-	static inline Simd add(const Simd &lhs, const Simd &rhs) {
+	/// <summary> A mask with all bits set in the lanes where lhs equals rhs, and cleared elsewhere. </summary>
+	static inline Simd equal(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_add_pd(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_add_pd(lhs.reg[1], rhs.reg[1]);
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_cmpeq_epi64(lhs.reg, rhs.reg);
+#else
+		const __m128i halves = _mm_cmpeq_epi32(lhs.reg, rhs.reg);
+		res.reg = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+#endif
 		return res;
 	}
 
-	static inline Simd sub(const Simd &lhs, const Simd &rhs) {
+	/// <summary> Bitwise and of the lanes, combines masks. </summary>
+	static inline Simd bitAnd(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		res.reg[0] = _mm_sub_pd(lhs.reg[0], rhs.reg[0]);
-		res.reg[1] = _mm_sub_pd(lhs.reg[1], rhs.reg[1]);
+		res.reg = _mm_and_si128(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd mul(const Simd &lhs, double rhs) {
+	/// <summary> Bitwise or of the lanes, combines masks. </summary>
+	static inline Simd bitOr(const Simd &lhs, const Simd &rhs) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg[0] = _mm_mul_pd(lhs.reg[0], tmp);
-		res.reg[1] = _mm_mul_pd(lhs.reg[1], tmp);
+		res.reg = _mm_or_si128(lhs.reg, rhs.reg);
 		return res;
 	}
 
-	static inline Simd div(const Simd &lhs, double rhs) {
+	/// <summary> Bitwise complement of the lanes, inverts masks. </summary>
+	static inline Simd bitNot(const Simd &arg) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg[0] = _mm_div_pd(lhs.reg[0], tmp);
-		res.reg[1] = _mm_div_pd(lhs.reg[1], tmp);
+		res.reg = _mm_xor_si128(arg.reg, _mm_set1_epi32(-1));
 		return res;
 	}
 
-	static inline Simd add(const Simd &lhs, double rhs) {
+	/// <summary> The highest bit of each lane, lane i in bit i. For masks, the bits of the set lanes. </summary>
+	static inline int movemask(const Simd &arg) {
+		return _mm_movemask_pd(_mm_castsi128_pd(arg.reg));
+	}
+
+	/// <summary> Takes the lanes of ifTrue where the mask is set, and of ifFalse elsewhere. </summary>
+	static inline Simd select(const Simd &mask, const Simd &ifTrue, const Simd &ifFalse) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg[0] = _mm_add_pd(lhs.reg[0], tmp);
-		res.reg[1] = _mm_add_pd(lhs.reg[1], tmp);
+#if defined(__SSE4_1__) || defined(__AVX__)
+		res.reg = _mm_blendv_epi8(ifFalse.reg, ifTrue.reg, mask.reg);
+#else
+		res.reg = _mm_or_si128(_mm_and_si128(mask.reg, ifTrue.reg), _mm_andnot_si128(mask.reg, ifFalse.reg));
+#endif
 		return res;
 	}
 
-	static inline Simd sub(const Simd &lhs, double rhs) {
+	/// <summary> Shifts the bits of each lane left by <paramref name="count"/>. </summary>
+	static inline Simd shiftLeft(const Simd &arg, int count) {
 		Simd res;
-		__m128d tmp = _mm_set1_pd(rhs);
-		res.reg[0] = _mm_sub_pd(lhs.reg[0], tmp);
-		res.reg[1] = _mm_sub_pd(lhs.reg[1], tmp);
+		res.reg = _mm_sll_epi64(arg.reg, _mm_cvtsi32_si128(count));
 		return res;
 	}
 
-	static inline Simd mad(const Simd &a, const Simd &b, const Simd &c) {
-		return add(mul(a, b), c);
+	/// <summary> Shifts the bits of each lane right by <paramref name="count"/>, copying the sign bit. </summary>
+	static inline Simd shiftRight(const Simd &arg, int count) {
+		// There's no arithmetic 64 bit shift before AVX-512, so the sign is shifted in from the other side.
+		Simd res;
+		const __m128i logical = _mm_srl_epi64(arg.reg, _mm_cvtsi32_si128(count));
+		const __m128i sign = _mm_sll_epi64(impl::SignEpi64(arg.reg), _mm_cvtsi32_si128(64 - count));
+		res.reg = _mm_or_si128(logical, sign);
+		return res;
 	}
 
-	static inline Simd spread(double value) {
+	static inline Simd set(int64_t x, int64_t y) {
 		Simd res;
-		res.reg[0] = _mm_set1_pd(value);
-		res.reg[1] = _mm_set1_pd(value);
+		res.reg = _mm_set_epi64x(y, x);
 		return res;
 	}
 
-	static inline Simd set(double x, double y, double z, double w) {
+	/// <summary> Loads 2 consecutive values from memory, which need not be aligned. </summary>
+	static inline Simd load(const int64_t *ptr) {
 		Simd res;
-		res.reg[0] = _mm_setr_pd(x, y);
-		res.reg[1] = _mm_setr_pd(z, w);
+		res.reg = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
 		return res;
 	}
 
+	/// <summary> Stores the lanes to 2 consecutive values in memory, which need not be aligned. </summary>
+	static inline void store(int64_t *ptr, const Simd &arg) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), arg.reg);
+	}
+
+	/// <summary> Converts the lanes to <typeparamref name="U"/> like a static_cast. </summary>
+	/// <remarks> SSE can't convert 64 bit integers, this converts the lanes one by one. </remarks>
+	template<class U>
+	static inline Simd<U, 2> convert(const Simd &arg) {
+		return Simd<U, 2>::set(U(arg.v[0]), U(arg.v[1]));
+	}
 
 	template<int Count>
-	static inline double dot(const Simd &lhs, const Simd &rhs) {
-		static_assert(Count <= 4, "Number of elements to dot must be smaller or equal to dimension.");
+	static inline int64_t dot(const Simd &lhs, const Simd &rhs) {
+		static_assert(Count <= 2, "Number of elements to dot must be smaller or equal to dimension.");
 		static_assert(0 < Count, "Count must not be zero.");
-		__m128d regs[2];
-		regs[0] = _mm_mul_pd(lhs.reg[0], rhs.reg[0]);
-		regs[1] = _mm_mul_pd(lhs.reg[1], rhs.reg[1]);
-
-		for (int i = 3; i >= Count; --i) {
-			reinterpret_cast<double *>(&regs)[i] = 0.0;
-		}
-
-		double sum;
-		regs[0] = _mm_add_pd(regs[0], regs[1]);
-		sum = reinterpret_cast<double *>(&regs[0])[0] + reinterpret_cast<double *>(&regs[0])[1];
-
-		return sum;
+		const Simd m = mul(lhs, rhs);
+		return Count == 2 ? m.v[0] + m.v[1] : m.v[0];
 	}
 
+	/// <summary> The dot product of the first Count lanes, in all lanes. </summary>
+	template<int Count>
+	static inline Simd dotSpread(const Simd &lhs, const Simd &rhs) {
+		return spread(dot<Count>(lhs, rhs));
+	}
 
-	template<int i0, int i1, int i2, int i3>
+	template<int i0, int i1>
 	static inline Simd shuffle(const Simd &arg) {
 		Simd ret;
-		ret.v[3] = arg.v[i0];
-		ret.v[2] = arg.v[i1];
-		ret.v[1] = arg.v[i2];
-		ret.v[0] = arg.v[i3];
+		ret.reg = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(arg.reg), _mm_castsi128_pd(arg.reg), _MM_SHUFFLE2(i0, i1)));
 		return ret;
 	}
 };
-//*/
 
 } // namespace mathter
\ No newline at end of file
@@ -78,11 +78,19 @@ namespace mathter {
 
 template <class T, int Dim, bool Packed>
 Vector<T, Dim, Packed> Clamp(const Vector<T, Dim, Packed>& arg, T lower, T upper) {
-	Vector<T, Dim, Packed> ret;
-	for (int i = 0; i < arg.Dimension(); ++i) {
-		ret(i) = Clamp(arg(i), lower, upper);
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> ret;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			ret(i) = Clamp(arg(i), lower, upper);
+		}
+		return ret;
+	}
+	else {
+		// Same operand order as the scalar version, so NaNs clamp the same way.
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		const SimdT upperClamped = SimdT::min(arg.simd, SimdT::spread(upper));
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::max(upperClamped, SimdT::spread(lower)) };
 	}
-	return ret;
 }
 
 template <class T, int Dim, bool Packed>
@@ -297,6 +297,39 @@ inline Vector<T, Dim, Packed> operator+(const Vector<T, Dim, Packed>& arg) {
 	return arg;
 }
 
+/// <summary> Shifts the bits of all elements of an integer vector left by <paramref name="count"/>. </summary>
+template <class T, int Dim, bool Packed, class = std::enable_if_t<std::is_integral_v<T>>>
+inline Vector<T, Dim, Packed> operator<<(const Vector<T, Dim, Packed>& lhs, int count) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> result;
+		for (int i = 0; i < Dim; ++i) {
+			result[i] = T(lhs.data[i] << count);
+		}
+		return result;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::shiftLeft(lhs.simd, count) };
+	}
+}
+
+/// <summary> Shifts the bits of all elements of an integer vector right by <paramref name="count"/>. </summary>
+/// <remarks> Signed elements are shifted arithmetically, so this divides by 2^count rounding towards negative infinity. </remarks>
+template <class T, int Dim, bool Packed, class = std::enable_if_t<std::is_integral_v<T>>>
+inline Vector<T, Dim, Packed> operator>>(const Vector<T, Dim, Packed>& lhs, int count) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> result;
+		for (int i = 0; i < Dim; ++i) {
+			result[i] = T(lhs.data[i] >> count);
+		}
+		return result;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::shiftRight(lhs.simd, count) };
+	}
+}
+
 //------------------------------------------------------------------------------
 // Swizzle ops
 //------------------------------------------------------------------------------
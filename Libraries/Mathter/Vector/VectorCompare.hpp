@@ -2,24 +2,248 @@
 
 #include "VectorImpl.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
 namespace mathter {
 
+
+/// <summary> The result of comparing two vectors lane by lane. </summary>
+/// <remarks> The lanes are stored the way SIMD comparisons produce them, all bits set for true and cleared for false.
+///		Combine masks with &amp;, | and !, and use <see cref="Any"/>, <see cref="All"/> and <see cref="Select"/>
+///		instead of branching on each lane. </remarks>
+template <class T, int Dim, bool Packed>
+class VectorMask {
+public:
+	/// <summary> All bits set in the true lanes, cleared in the false lanes. </summary>
+	Vector<T, Dim, Packed> lanes;
+
+	/// <summary> Returns whether the lane is true. </summary>
+	bool operator[](int idx) const {
+		assert(idx < Dim);
+		T zero;
+		std::memset(&zero, 0, sizeof(T));
+		return std::memcmp(&lanes.data[idx], &zero, sizeof(T)) != 0;
+	}
+};
+
+
+namespace impl {
+	template <class T>
+	T MaskLane(bool value) {
+		T lane;
+		std::memset(&lane, value ? 0xFF : 0, sizeof(T));
+		return lane;
+	}
+
+	template <class T, int Dim, bool Packed, class Compare>
+	VectorMask<T, Dim, Packed> CompareLanes(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs, Compare compare) {
+		VectorMask<T, Dim, Packed> mask;
+		for (int i = 0; i < Dim; ++i) {
+			mask.lanes.data[i] = MaskLane<T>(compare(lhs.data[i], rhs.data[i]));
+		}
+		return mask;
+	}
+} // namespace impl
+
+
+/// <summary> Compares the vectors lane by lane for lhs &lt; rhs. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator<(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return impl::CompareLanes(lhs, rhs, std::less<T>{});
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::less(lhs.simd, rhs.simd) } };
+	}
+}
+
+/// <summary> Compares the vectors lane by lane for lhs &lt;= rhs. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator<=(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return impl::CompareLanes(lhs, rhs, std::less_equal<T>{});
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::lessEqual(lhs.simd, rhs.simd) } };
+	}
+}
+
+/// <summary> Compares the vectors lane by lane for lhs &gt; rhs. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator>(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	return rhs < lhs;
+}
+
+/// <summary> Compares the vectors lane by lane for lhs &gt;= rhs. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator>=(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	return rhs <= lhs;
+}
+
+/// <summary> Compares the vectors lane by lane for exact equality. </summary>
+/// <remarks> Unlike operator==, which tells if all elements are equal. </remarks>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> Equal(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return impl::CompareLanes(lhs, rhs, std::equal_to<T>{});
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::equal(lhs.simd, rhs.simd) } };
+	}
+}
+
+/// <summary> Compares the vectors lane by lane for inequality. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> NotEqual(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
+	return !Equal(lhs, rhs);
+}
+
+/// <summary> Compares the vectors lane by lane with a tolerance. </summary>
+/// <remarks> A lane is true if the elements differ by at most <paramref name="tolerance"/> times the larger magnitude,
+///		or by at most <paramref name="tolerance"/> when both magnitudes are below 1. NaNs are never equal. </remarks>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> NearlyEqual(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs, T tolerance) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return impl::CompareLanes(lhs, rhs, [tolerance](T l, T r) {
+			const T scale = std::max(T(1), std::max(std::abs(l), std::abs(r)));
+			return std::abs(l - r) <= tolerance * scale;
+		});
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		const SimdT difference = SimdT::abs(SimdT::sub(lhs.simd, rhs.simd));
+		const SimdT scale = SimdT::max(SimdT::max(SimdT::abs(lhs.simd), SimdT::abs(rhs.simd)), SimdT::spread(T(1)));
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::lessEqual(difference, SimdT::mul(scale, tolerance)) } };
+	}
+}
+
+
+/// <summary> True in the lanes where both masks are true. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator&(const VectorMask<T, Dim, Packed>& lhs, const VectorMask<T, Dim, Packed>& rhs) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		VectorMask<T, Dim, Packed> mask;
+		for (int i = 0; i < Dim; ++i) {
+			mask.lanes.data[i] = impl::MaskLane<T>(lhs[i] && rhs[i]);
+		}
+		return mask;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::bitAnd(lhs.lanes.simd, rhs.lanes.simd) } };
+	}
+}
+
+/// <summary> True in the lanes where either mask is true. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator|(const VectorMask<T, Dim, Packed>& lhs, const VectorMask<T, Dim, Packed>& rhs) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		VectorMask<T, Dim, Packed> mask;
+		for (int i = 0; i < Dim; ++i) {
+			mask.lanes.data[i] = impl::MaskLane<T>(lhs[i] || rhs[i]);
+		}
+		return mask;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::bitOr(lhs.lanes.simd, rhs.lanes.simd) } };
+	}
+}
+
+/// <summary> Inverts the mask. </summary>
+template <class T, int Dim, bool Packed>
+VectorMask<T, Dim, Packed> operator!(const VectorMask<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		VectorMask<T, Dim, Packed> mask;
+		for (int i = 0; i < Dim; ++i) {
+			mask.lanes.data[i] = impl::MaskLane<T>(!arg[i]);
+		}
+		return mask;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { { Vector<T, Dim, Packed>::FromSimd, SimdT::bitNot(arg.lanes.simd) } };
+	}
+}
+
+/// <summary> Returns true if any lane of the mask is true. </summary>
+/// <remarks> The padding lanes of SIMD vectors are ignored. </remarks>
+template <class T, int Dim, bool Packed>
+bool Any(const VectorMask<T, Dim, Packed>& mask) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		bool any = mask[0];
+		for (int i = 1; i < Dim; ++i) {
+			any = any || mask[i];
+		}
+		return any;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return (SimdT::movemask(mask.lanes.simd) & ((1 << Dim) - 1)) != 0;
+	}
+}
+
+/// <summary> Returns true if all lanes of the mask are true. </summary>
+/// <remarks> The padding lanes of SIMD vectors are ignored. </remarks>
+template <class T, int Dim, bool Packed>
+bool All(const VectorMask<T, Dim, Packed>& mask) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		bool all = mask[0];
+		for (int i = 1; i < Dim; ++i) {
+			all = all && mask[i];
+		}
+		return all;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return (SimdT::movemask(mask.lanes.simd) & ((1 << Dim) - 1)) == (1 << Dim) - 1;
+	}
+}
+
+/// <summary> Takes the elements of <paramref name="ifTrue"/> in the true lanes of the mask, and of <paramref name="ifFalse"/> elsewhere. </summary>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Select(const VectorMask<T, Dim, Packed>& mask, const Vector<T, Dim, Packed>& ifTrue, const Vector<T, Dim, Packed>& ifFalse) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> result;
+		for (int i = 0; i < Dim; ++i) {
+			result.data[i] = mask[i] ? ifTrue.data[i] : ifFalse.data[i];
+		}
+		return result;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::select(mask.lanes.simd, ifTrue.simd, ifFalse.simd) };
+	}
+}
+
+
 /// <summary> Exactly compares two vectors. </summary>
 /// <remarks> &lt;The usual warning about floating point numbers&gt; </remarks>
 template <class T, int Dim, bool Packed>
 bool operator==(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
-	bool same = lhs.data[0] == rhs.data[0];
-	for (int i = 1; i < Dim; ++i) {
-		same = same && lhs.data[i] == rhs.data[i];
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		bool same = lhs.data[0] == rhs.data[0];
+		for (int i = 1; i < Dim; ++i) {
+			same = same && lhs.data[i] == rhs.data[i];
+		}
+		return same;
+	}
+	else {
+		return All(Equal(lhs, rhs));
 	}
-	return same;
 }
 
 /// <summary> Exactly compares two vectors. </summary>
 /// <remarks> &lt;The usual warning about floating point numbers&gt; </remarks>
 template <class T, int Dim, bool Packed>
 bool operator!=(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
-	return !operator==(rhs);
+	return !(lhs == rhs);
 }
 
 } // namespace mathter
\ No newline at end of file
@@ -11,6 +11,8 @@
 
 #include "VectorImpl.hpp"
 
+#include <utility>
+
 namespace mathter {
 
 
@@ -31,9 +33,22 @@ T LengthSquared(const Vector<T, Dim, Packed>& v) {
 }
 
 /// <summary> Returns the length of the vector. </summary>
-template <class T, int Dim, bool Packed>
+/// <remarks> With <see cref="ePrecision::FAST"/>, the squared length is multiplied by its approximate reciprocal
+///		square root instead of taking the square root, see <see cref="ePrecision"/>. Null vectors still give zero,
+///		but lengths below the square root of the smallest normal number lose their precision. </remarks>
+template <ePrecision Precision = ePrecision::PRECISE, class T, int Dim, bool Packed>
 T Length(const Vector<T, Dim, Packed>& v) {
-	return (T)std::sqrt((T)LengthSquared(v));
+	if constexpr (Precision == ePrecision::FAST && traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		// A scalar result needs no spread, the plain dot product reduces with fewer shuffles.
+		const T lengthSquared = SimdT::template dot<Dim>(v.simd, v.simd);
+		// The clamp keeps the reciprocal finite, so that zero times it stays zero.
+		const T clamped = std::max(lengthSquared, std::numeric_limits<T>::min());
+		return lengthSquared * SimdT::rsqrt(SimdT::spread(clamped)).v[0];
+	}
+	else {
+		return (T)std::sqrt((T)LengthSquared(v));
+	}
 }
 
 /// <summary> Returns the length of the vector, avoids overflow and underflow, so it's more expensive. </summary>
@@ -57,11 +72,26 @@ auto Distance(const Vector<T, Dim, Packed1>& lhs, const Vector<U, Dim, Packed2>&
 }
 
 /// <summary> Makes a unit vector, but keeps direction. </summary>
-template <class T, int Dim, bool Packed>
+/// <remarks> The squared length stays in a SIMD register, spread across all lanes.
+///		With <see cref="ePrecision::FAST"/>, the vector is multiplied by an approximate reciprocal length instead of
+///		being divided by the length, see <see cref="ePrecision"/>. </remarks>
+template <ePrecision Precision = ePrecision::PRECISE, class T, int Dim, bool Packed>
 Vector<T, Dim, Packed> Normalize(const Vector<T, Dim, Packed>& v) {
 	assert(!IsNullvector(v));
-	T l = Length(v);
-	return v / l;
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		T l = Length(v);
+		return v / l;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		const SimdT lengthSquared = SimdT::template dotSpread<Dim>(v.simd, v.simd);
+		if constexpr (Precision == ePrecision::FAST) {
+			return { Vector<T, Dim, Packed>::FromSimd, SimdT::mul(v.simd, SimdT::rsqrt(lengthSquared)) };
+		}
+		else {
+			return { Vector<T, Dim, Packed>::FromSimd, SimdT::div(v.simd, SimdT::sqrt(lengthSquared)) };
+		}
+	}
 }
 
 /// <summary> Checks if the vector is unit vector. There's some tolerance due to floating points. </summary>
@@ -171,20 +201,268 @@ Vector<T, 3, Packed> Cross(const std::array<const Vector<T, 3, Packed>*, 2>& arg
 /// <summary> Returns the element-wise minimum of arguments </summary>
 template <class T, int Dim, bool Packed>
 Vector<T, Dim, Packed> Min(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
-	Vector<T, Dim, Packed> res;
-	for (int i = 0; i < lhs.Dimension(); ++i) {
-		res[i] = std::min(lhs[i], rhs[i]);
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < lhs.Dimension(); ++i) {
+			res[i] = std::min(lhs[i], rhs[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::min(lhs.simd, rhs.simd) };
 	}
-	return res;
 }
 /// <summary> Returns the element-wise maximum of arguments </summary>
 template <class T, int Dim, bool Packed>
 Vector<T, Dim, Packed> Max(const Vector<T, Dim, Packed>& lhs, const Vector<T, Dim, Packed>& rhs) {
-	Vector<T, Dim, Packed> res;
-	for (int i = 0; i < lhs.Dimension(); ++i) {
-		res[i] = std::max(lhs[i], rhs[i]);
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < lhs.Dimension(); ++i) {
+			res[i] = std::max(lhs[i], rhs[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::max(lhs.simd, rhs.simd) };
+	}
+}
+
+/// <summary> Returns the element-wise absolute value. </summary>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Abs(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::abs(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::abs(arg.simd) };
+	}
+}
+
+/// <summary> Rounds all elements towards negative infinity. </summary>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Floor(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = T(std::floor(arg[i]));
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::floor(arg.simd) };
+	}
+}
+
+/// <summary> Rounds all elements to the nearest integer. </summary>
+/// <remarks> Halfway cases are rounded to even like std::nearbyint, unlike std::round. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Round(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = T(std::nearbyint(arg[i]));
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::round(arg.simd) };
+	}
+}
+
+/// <summary> Interpolates linearly between <paramref name="from"/> and <paramref name="to"/>. </summary>
+/// <remarks> Returns <paramref name="from"/> for t=0 and <paramref name="to"/> for t=1, but t is not clamped. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Lerp(const Vector<T, Dim, Packed>& from, const Vector<T, Dim, Packed>& to, T t) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return from + (to - from) * t;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::mad(SimdT::sub(to.simd, from.simd), SimdT::spread(t), from.simd) };
+	}
+}
+
+/// <summary> Interpolates linearly between <paramref name="from"/> and <paramref name="to"/> with a separate t for each element. </summary>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Lerp(const Vector<T, Dim, Packed>& from, const Vector<T, Dim, Packed>& to, const Vector<T, Dim, Packed>& t) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		return from + (to - from) * t;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::mad(SimdT::sub(to.simd, from.simd), t.simd, from.simd) };
+	}
+}
+
+/// <summary> Returns 0 for the elements smaller than <paramref name="edge"/> and 1 for the rest. </summary>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Step(T edge, const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = arg[i] < edge ? T(0) : T(1);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		const SimdT below = SimdT::less(arg.simd, SimdT::spread(edge));
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::select(below, SimdT::spread(T(0)), SimdT::spread(T(1))) };
+	}
+}
+
+/// <summary> Goes smoothly from 0 to 1 as the elements go from <paramref name="edge0"/> to <paramref name="edge1"/>. </summary>
+/// <remarks> The Hermite polynomial 3t^2 - 2t^3 of t clamped to [0, 1], where t is the element's position between the edges. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Smoothstep(T edge0, T edge1, const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			const T t = std::max(T(0), std::min(T(1), (arg[i] - edge0) / (edge1 - edge0)));
+			res[i] = t * t * (T(3) - T(2) * t);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		const SimdT scaled = SimdT::mul(SimdT::sub(arg.simd, SimdT::spread(edge0)), T(1) / (edge1 - edge0));
+		const SimdT t = SimdT::max(SimdT::min(scaled, SimdT::spread(T(1))), SimdT::spread(T(0)));
+		const SimdT polynomial = SimdT::mad(SimdT::spread(T(-2)), t, SimdT::spread(T(3)));
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::mul(SimdT::mul(t, t), polynomial) };
+	}
+}
+
+
+/// <summary> Element-wise sine. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdSinCos for the accuracy.
+///		Other vectors call std::sin for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Sin(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::sin(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::sin(arg.simd) };
+	}
+}
+
+/// <summary> Element-wise cosine. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdSinCos for the accuracy.
+///		Other vectors call std::cos for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Cos(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::cos(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::cos(arg.simd) };
+	}
+}
+
+/// <summary> Element-wise sine and cosine, in this order. </summary>
+/// <remarks> Cheaper than <see cref="Sin"/> and <see cref="Cos"/> separately, as the two share the range reduction. </remarks>
+template <class T, int Dim, bool Packed>
+std::pair<Vector<T, Dim, Packed>, Vector<T, Dim, Packed>> SinCos(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		return { Sin(arg), Cos(arg) };
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		SimdT sine, cosine;
+		SimdT::sincos(arg.simd, sine, cosine);
+		return { { Vector<T, Dim, Packed>::FromSimd, sine }, { Vector<T, Dim, Packed>::FromSimd, cosine } };
+	}
+}
+
+/// <summary> Element-wise angle of the points (x, y) from the x axis, in [-pi, pi]. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdAtan2 for the accuracy.
+///		Other vectors call std::atan2 for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Atan2(const Vector<T, Dim, Packed>& y, const Vector<T, Dim, Packed>& x) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < x.Dimension(); ++i) {
+			res[i] = std::atan2(y[i], x[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::atan2(y.simd, x.simd) };
+	}
+}
+
+/// <summary> Element-wise arc cosine, in [0, pi]. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdAcos for the accuracy.
+///		Other vectors call std::acos for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Acos(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::acos(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::acos(arg.simd) };
+	}
+}
+
+/// <summary> Element-wise exponential function, base e. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdExp for the accuracy.
+///		Other vectors call std::exp for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Exp(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::exp(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::exp(arg.simd) };
+	}
+}
+
+/// <summary> Element-wise natural logarithm. </summary>
+/// <remarks> Float vectors with SIMD use a polynomial approximation, see mathter::impl::SimdLog for the accuracy.
+///		Other vectors call std::log for each element. </remarks>
+template <class T, int Dim, bool Packed>
+Vector<T, Dim, Packed> Log(const Vector<T, Dim, Packed>& arg) {
+	if constexpr (!traits::HasSimd<Vector<T, Dim, Packed>>::value || !std::is_same<T, float>::value) {
+		Vector<T, Dim, Packed> res;
+		for (int i = 0; i < arg.Dimension(); ++i) {
+			res[i] = std::log(arg[i]);
+		}
+		return res;
+	}
+	else {
+		using SimdT = decltype(VectorData<T, Dim, Packed>::simd);
+		return { Vector<T, Dim, Packed>::FromSimd, SimdT::log(arg.simd) };
 	}
-	return res;
 }
 
 
@@ -381,6 +381,78 @@ public:
 };
 
 
+// Small SIMD int32 vectors
+// Only with SSE2, the generic Simd would divide by the zero in the padding lane.
+#ifdef MATHTER_SSE2_HACK
+template <>
+class VectorData<int32_t, 3, false> {
+	using ST = int32_t;
+
+public:
+	using SimdT = Simd<ST, 4>;
+	VectorData() {}
+	VectorData(const VectorData& rhs) { simd = rhs.simd; }
+	explicit VectorData(SimdT simd) : simd(simd) {}
+	VectorData& operator=(const VectorData& rhs) {
+		simd = rhs.simd;
+		return *this;
+	}
+	union {
+		/// <summary> Leave this member alone. You can't fuck it up though. </summary>
+		SimdT simd;
+		struct {
+			ST x, y, z;
+		};
+		/// <summary> Raw array containing the elements. </summary>
+		ST data[3];
+#include "../Swizzle/Swizzle_3.inc.hpp"
+	};
+};
+
+template <>
+class VectorData<int32_t, 4, false> {
+	using ST = int32_t;
+
+public:
+	using SimdT = Simd<ST, 4>;
+	VectorData() {}
+	VectorData(const VectorData& rhs) { simd = rhs.simd; }
+	explicit VectorData(SimdT simd) : simd(simd) {}
+	VectorData& operator=(const VectorData& rhs) {
+		simd = rhs.simd;
+		return *this;
+	}
+	union {
+		/// <summary> Leave this member alone. You can't fuck it up though. </summary>
+		SimdT simd;
+		struct {
+			ST x, y, z, w;
+		};
+		/// <summary> Raw array containing the elements. </summary>
+		ST data[4];
+#include "../Swizzle/Swizzle_4.inc.hpp"
+	};
+};
+#endif
+
+
+namespace impl {
+	/// <summary> Whether vectors of U convert to vectors of T in SIMD registers, between int32 and float. </summary>
+	template <class U, class T, int Dim, bool UPacked, bool Packed>
+	constexpr bool HasSimdConversion() {
+		if constexpr (traits::HasSimd<VectorData<U, Dim, UPacked>>::value && traits::HasSimd<VectorData<T, Dim, Packed>>::value) {
+			using SourceSimdT = decltype(VectorData<U, Dim, UPacked>::simd);
+			using DestSimdT = decltype(VectorData<T, Dim, Packed>::simd);
+			return (std::is_same_v<SourceSimdT, Simd<int32_t, 4>> && std::is_same_v<DestSimdT, Simd<float, 4>>)
+				   || (std::is_same_v<SourceSimdT, Simd<float, 4>> && std::is_same_v<DestSimdT, Simd<int32_t, 4>>);
+		}
+		else {
+			return false;
+		}
+	}
+} // namespace impl
+
+
 //------------------------------------------------------------------------------
 // General vector class
 //------------------------------------------------------------------------------
@@ -462,8 +534,13 @@ public:
 
 	template <class U, bool UPacked, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0>
 	Vector(const Vector<U, Dim, UPacked>& other) {
-		for (int i = 0; i < Dim; ++i) {
-			this->data[i] = (T)other.data[i];
+		if constexpr (impl::HasSimdConversion<U, T, Dim, UPacked, Packed>()) {
+			this->simd = decltype(other.simd)::template convert<T>(other.simd);
+		}
+		else {
+			for (int i = 0; i < Dim; ++i) {
+				this->data[i] = (T)other.data[i];
+			}
 		}
 	}
 
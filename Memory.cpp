@@ -0,0 +1,178 @@
+#include "Memory.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#elif __unix__
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#endif
+
+
+#if defined(__linux__)
+
+size_t SmallPageSize() {
+	return size_t(sysconf(_SC_PAGESIZE));
+}
+
+size_t HugePageSize() {
+	static const size_t hugePageSize = [] {
+		size_t sizeKb = 0;
+		if (FILE* meminfo = fopen("/proc/meminfo", "r")) {
+			char line[256];
+			while (fgets(line, sizeof(line), meminfo)) {
+				if (sscanf(line, "Hugepagesize: %zu kB", &sizeKb) == 1) {
+					break;
+				}
+			}
+			fclose(meminfo);
+		}
+		return sizeKb * 1024;
+	}();
+	return hugePageSize;
+}
+
+/// <summary> Tells whether the kernel has backed any part of the mapping around <paramref name="address"/> by transparent huge pages. </summary>
+static bool IsBackedByTransparentHugePages(const void* address) {
+	const auto target = reinterpret_cast<uintptr_t>(address);
+	bool inMapping = false;
+	size_t anonHugeKb = 0;
+	if (FILE* smaps = fopen("/proc/self/smaps", "r")) {
+		char line[512];
+		while (fgets(line, sizeof(line), smaps)) {
+			unsigned long begin, end;
+			// Mapping headers start with the address range, the other lines are "Field: value" pairs.
+			if (sscanf(line, "%lx-%lx ", &begin, &end) == 2) {
+				if (inMapping) {
+					break;
+				}
+				inMapping = begin <= target && target < end;
+			}
+			else if (inMapping && sscanf(line, "AnonHugePages: %zu kB", &anonHugeKb) == 1) {
+				break;
+			}
+		}
+		fclose(smaps);
+	}
+	return anonHugeKb != 0;
+}
+
+#elif defined(_WIN32)
+
+size_t SmallPageSize() {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return size_t(info.dwPageSize);
+}
+
+size_t HugePageSize() {
+	return 0;
+}
+
+#else
+
+size_t SmallPageSize() {
+	return 4096;
+}
+
+size_t HugePageSize() {
+	return 0;
+}
+
+#endif
+
+
+OperandArena::OperandArena(size_t capacity, const OperandPlacement& placement)
+	: m_placement(placement), m_capacity(capacity), m_pageSize(SmallPageSize()) {
+	if (placement.alignment == 0 || (placement.alignment & (placement.alignment - 1)) != 0) {
+		throw std::invalid_argument("operand alignment must be a power of two");
+	}
+
+#if defined(__linux__)
+	const size_t hugePageSize = HugePageSize();
+	if (placement.hugePages && hugePageSize != 0) {
+		const size_t mappedSize = (capacity + hugePageSize - 1) / hugePageSize * hugePageSize;
+
+		void* explicitHuge = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (explicitHuge != MAP_FAILED) {
+			m_memory = static_cast<char*>(explicitHuge);
+			m_mappedSize = mappedSize;
+			m_pageSize = hugePageSize;
+			return;
+		}
+
+		// Transparent huge pages need a huge page aligned region, so over-map and trim the ends.
+		const size_t overSize = mappedSize + hugePageSize;
+		void* mapped = mmap(nullptr, overSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapped != MAP_FAILED) {
+			const auto mappedBegin = reinterpret_cast<uintptr_t>(mapped);
+			const auto alignedBegin = (mappedBegin + hugePageSize - 1) / hugePageSize * hugePageSize;
+			const size_t head = alignedBegin - mappedBegin;
+			const size_t tail = overSize - head - mappedSize;
+			if (head != 0) {
+				munmap(mapped, head);
+			}
+			if (tail != 0) {
+				munmap(reinterpret_cast<void*>(alignedBegin + mappedSize), tail);
+			}
+
+			m_memory = reinterpret_cast<char*>(alignedBegin);
+			m_mappedSize = mappedSize;
+			madvise(m_memory, mappedSize, MADV_HUGEPAGE);
+			// Fault the pages in now, so that the kernel decides on the page size before the check.
+			for (size_t i = 0; i < mappedSize; i += m_pageSize) {
+				m_memory[i] = 0;
+			}
+			m_pageSize = IsBackedByTransparentHugePages(m_memory) ? hugePageSize : m_pageSize;
+			return;
+		}
+	}
+#endif
+
+	m_memory = static_cast<char*>(::operator new(capacity, std::align_val_t{ 2 * std::max(placement.alignment, CacheLineSize) }));
+}
+
+
+OperandArena::~OperandArena() {
+#if defined(__linux__)
+	if (m_mappedSize != 0) {
+		munmap(m_memory, m_mappedSize);
+		return;
+	}
+#endif
+	::operator delete(m_memory, std::align_val_t{ 2 * std::max(m_placement.alignment, CacheLineSize) });
+}
+
+
+void* OperandArena::Allocate(size_t bytes, size_t minAlignment) {
+	const size_t alignment = std::max(m_placement.alignment, minAlignment);
+	const size_t offset = m_placement.offset / minAlignment * minAlignment;
+
+	// Find the first address at or after the free space that is aligned to alignment, but not to 2*alignment.
+	const uintptr_t free = reinterpret_cast<uintptr_t>(m_memory) + m_used;
+	uintptr_t base = (free + alignment - 1) / alignment * alignment;
+	if (base % (2 * alignment) == 0) {
+		base += alignment;
+	}
+
+	const uintptr_t address = base + offset;
+	const size_t end = address + bytes - reinterpret_cast<uintptr_t>(m_memory);
+	if (end > m_capacity) {
+		throw std::bad_alloc();
+	}
+	m_used = end;
+	return reinterpret_cast<void*>(address);
+}
+
+
+size_t AddressAlignment(const void* address) {
+	const auto value = reinterpret_cast<uintptr_t>(address);
+	size_t alignment = 1;
+	while (alignment < CacheLineSize && value % (2 * alignment) == 0) {
+		alignment *= 2;
+	}
+	return alignment;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+
+constexpr size_t CacheLineSize = 64;
+
+
+/// <summary> Where operand arrays are placed in memory relative to alignment boundaries. </summary>
+struct OperandPlacement {
+	/// <summary> The arrays start at an address that is a multiple of this, but not of twice this. Must be a power of two. </summary>
+	/// <remarks> Types with stricter alignment requirements raise it to their own alignof. </remarks>
+	size_t alignment = CacheLineSize;
+	/// <summary> Bytes added to the aligned start address. Rounded down to a multiple of the alignof the element type. </summary>
+	size_t offset = 0;
+	/// <summary> Back the arrays by huge pages if the system provides them. </summary>
+	/// <remarks> Explicit huge pages (MAP_HUGETLB) are tried first, then transparent huge pages (MADV_HUGEPAGE). </remarks>
+	bool hugePages = false;
+
+	bool operator==(const OperandPlacement&) const = default;
+};
+
+
+/// <summary> A bump allocator over a single block of memory. Memory is released all at once when the arena is destroyed. </summary>
+/// <remarks> The block can be reused by <see cref="Reset"/>, which keeps its pages and thus its addresses and page size. </remarks>
+class OperandArena {
+public:
+	OperandArena(size_t capacity, const OperandPlacement& placement);
+	~OperandArena();
+	OperandArena(const OperandArena&) = delete;
+	OperandArena& operator=(const OperandArena&) = delete;
+
+	/// <summary> Returns memory for <paramref name="bytes"/> bytes placed according to the arena's placement. </summary>
+	/// <param name="minAlignment"> The alignment the type stored in the memory requires at the very least. </param>
+	void* Allocate(size_t bytes, size_t minAlignment);
+	/// <summary> Makes the whole block available again. Arrays allocated before must already be destroyed. </summary>
+	void Reset() { m_used = 0; }
+
+	/// <summary> The number of bytes to reserve for an array of <paramref name="count"/> elements of type T. </summary>
+	template <class T>
+	static size_t Footprint(size_t count, const OperandPlacement& placement);
+
+	const OperandPlacement& Placement() const { return m_placement; }
+	size_t Capacity() const { return m_capacity; }
+	/// <summary> The size of the pages that actually back the arena's memory. </summary>
+	size_t PageSize() const { return m_pageSize; }
+
+private:
+	OperandPlacement m_placement;
+	char* m_memory;
+	size_t m_capacity;
+	size_t m_used = 0;
+	size_t m_pageSize;
+	size_t m_mappedSize = 0;
+};
+
+
+/// <summary> A fixed-size array of default constructed elements that lives in an <see cref="OperandArena"/>. </summary>
+template <class T>
+class OperandArray {
+public:
+	OperandArray(OperandArena& arena, size_t size);
+	~OperandArray();
+	OperandArray(const OperandArray&) = delete;
+	OperandArray& operator=(const OperandArray&) = delete;
+
+	T& operator[](size_t index) { return m_data[index]; }
+	const T& operator[](size_t index) const { return m_data[index]; }
+
+	T* data() { return m_data; }
+	const T* data() const { return m_data; }
+	size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+private:
+	T* m_data;
+	size_t m_size;
+};
+
+
+/// <summary> The size of regular memory pages. </summary>
+size_t SmallPageSize();
+
+/// <summary> The size of huge pages, or zero if the system has no huge pages. </summary>
+size_t HugePageSize();
+
+/// <summary> The largest power of two, up to the cache line size, that divides the address. </summary>
+size_t AddressAlignment(const void* address);
+
+/// <summary> The number of elements of the array that straddle a cache line boundary. </summary>
+template <class T>
+size_t CountLineSplits(const OperandArray<T>& array);
+
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+
+template <class T>
+size_t OperandArena::Footprint(size_t count, const OperandPlacement& placement) {
+	const size_t alignment = std::max(placement.alignment, alignof(T));
+	return count * sizeof(T) + 2 * alignment + placement.offset;
+}
+
+
+template <class T>
+OperandArray<T>::OperandArray(OperandArena& arena, size_t size) : m_size(size) {
+	m_data = static_cast<T*>(arena.Allocate(size * sizeof(T), alignof(T)));
+	for (size_t i = 0; i < size; ++i) {
+		new (m_data + i) T;
+	}
+}
+
+template <class T>
+OperandArray<T>::~OperandArray() {
+	for (size_t i = 0; i < m_size; ++i) {
+		m_data[i].~T();
+	}
+}
+
+
+template <class T>
+size_t CountLineSplits(const OperandArray<T>& array) {
+	size_t splits = 0;
+	for (size_t i = 0; i < array.size(); ++i) {
+		const auto first = reinterpret_cast<uintptr_t>(array.data() + i);
+		const auto last = first + sizeof(T) - 1;
+		splits += first / CacheLineSize != last / CacheLineSize;
+	}
+	return splits;
+}
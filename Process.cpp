@@ -27,26 +27,134 @@ void SetPriority() {
 	cout << endl;
 }
 
+InterruptionCounters ReadInterruptionCounters() {
+	return {};
+}
+
 #elif __unix__
 #include <pthread.h>
 #include <sched.h>
+#include <sys/resource.h>
+
+#include <cstdio>
+#include <cstring>
 
+#ifdef __linux__
+void SetAffinity() {
+	pthread_t this_thread = pthread_self();
+	cpu_set_t allowed;
+	int ret = pthread_getaffinity_np(this_thread, sizeof(allowed), &allowed);
+	if (ret == 0) {
+		// Pin to the first core the thread may run on, which is not necessarily core 0 in containers.
+		int cpu = 0;
+		while (cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &allowed)) {
+			++cpu;
+		}
+		cpu_set_t pinned;
+		CPU_ZERO(&pinned);
+		CPU_SET(cpu, &pinned);
+		ret = pthread_setaffinity_np(this_thread, sizeof(pinned), &pinned);
+	}
+	cout << (ret == 0 ? "Thread is limited to 1st CPU core." : "Failed to set thread affinity - cycle count may be incorrect.");
+	cout << endl;
+}
+#else
 void SetAffinity() {}
+#endif
 
 void SetPriority() {
 	pthread_t this_thread = pthread_self();
 	sched_param params;
 	params.sched_priority = sched_get_priority_max(SCHED_FIFO);
 	int ret = pthread_setschedparam(this_thread, SCHED_FIFO, &params);
-	cout << (ret == 0 ? "Thread set to highest priority." : "Failed to set thread priority class - times may have jitter.");
+	if (ret == 0) {
+		cout << "Thread set to highest priority.";
+	}
+	else {
+		cout << "Failed to set thread priority class (" << strerror(ret) << ") - times may have jitter, preempted samples will be discarded.";
+	}
 	cout << endl
 		 << endl;
 }
 
 
+#ifdef __linux__
+/// <summary> Sums the interrupts of all sources except the local timer on the CPU the thread currently runs on. </summary>
+static uint64_t ReadCpuInterrupts() {
+	FILE* file = fopen("/proc/interrupts", "r");
+	if (!file) {
+		return 0;
+	}
+
+	// The header lists the online CPUs, the column of the current CPU may differ from its number.
+	char line[4096];
+	int column = -1;
+	if (fgets(line, sizeof(line), file)) {
+		const int cpu = sched_getcpu();
+		int index = 0;
+		for (const char* token = strtok(line, " \t\n"); token; token = strtok(nullptr, " \t\n"), ++index) {
+			int tokenCpu;
+			if (sscanf(token, "CPU%d", &tokenCpu) == 1 && tokenCpu == cpu) {
+				column = index;
+			}
+		}
+	}
+
+	uint64_t total = 0;
+	while (column >= 0 && fgets(line, sizeof(line), file)) {
+		const char* label = line + strspn(line, " ");
+		if (strncmp(label, "LOC:", 4) == 0) {
+			continue;
+		}
+		const char* field = strchr(label, ':');
+		if (!field) {
+			continue;
+		}
+		++field;
+		for (int index = 0; index <= column; ++index) {
+			char* next;
+			unsigned long long count = strtoull(field, &next, 10);
+			if (next == field) {
+				break; // Rows like ERR and MIS only have a single column.
+			}
+			if (index == column) {
+				total += count;
+			}
+			field = next;
+		}
+	}
+
+	fclose(file);
+	return total;
+}
+#else
+static uint64_t ReadCpuInterrupts() {
+	return 0;
+}
+#endif
+
+
+InterruptionCounters ReadInterruptionCounters() {
+	InterruptionCounters counters;
+#ifdef RUSAGE_THREAD
+	rusage usage;
+	if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+		counters.voluntarySwitches = uint64_t(usage.ru_nvcsw);
+		counters.involuntarySwitches = uint64_t(usage.ru_nivcsw);
+	}
+#endif
+	counters.interrupts = ReadCpuInterrupts();
+	return counters;
+}
+
+
 #else
 
 void SetAffinity() {}
 void SetPriority() {}
 
+InterruptionCounters ReadInterruptionCounters() {
+	return {};
+}
+
 #endif
\ No newline at end of file
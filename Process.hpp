@@ -1,5 +1,22 @@
 #pragma once
 
+#include <cstdint>
+
 
 void SetAffinity();
-void SetPriority();
\ No newline at end of file
+void SetPriority();
+
+
+/// <summary> Running totals of the events that take the CPU away from the benchmark thread. </summary>
+struct InterruptionCounters {
+	/// <summary> Context switches because the thread blocked or yielded. </summary>
+	uint64_t voluntarySwitches = 0;
+	/// <summary> Context switches because the scheduler preempted the thread. </summary>
+	uint64_t involuntarySwitches = 0;
+	/// <summary> Interrupts serviced by the CPU the thread runs on, not counting the periodic timer tick. </summary>
+	uint64_t interrupts = 0;
+};
+
+/// <summary> Reads the interruption counters of the calling thread. </summary>
+/// <remarks> Counters that are not available on the platform are always zero. </remarks>
+InterruptionCounters ReadInterruptionCounters();
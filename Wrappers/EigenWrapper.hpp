@@ -3,7 +3,32 @@
 #include "../Libraries/Eigen/Dense"
 #include "../Libraries/Eigen/LU" 
 
+#include <array>
+#include <cmath>
 #include <random>
+#include <stdexcept>
+#include <utility>
+
+
+namespace Eigen {
+// LDLT compares array expressions to a scalar. C++20 also considers the reversed scalar == array friend operator,
+// which matches better than the member operator, and then rejects it for not returning bool. A non-template
+// operator in the original order wins over the reversed one, so one is declared for each matrix size factored.
+#define EIGEN_WRAPPER_LDLT_SCALAR_COMPARISONS(Size)                                                                          \
+	inline auto operator==(const ArrayWrapper<Block<Block<Matrix<float, Size, Size>, Size, 1, true>, Dynamic, 1, false>>& lhs, \
+						   const float& rhs) {                                                                            \
+		return lhs.operator==(rhs);                                                                                          \
+	}                                                                                                                        \
+	inline auto operator==(const ArrayWrapper<Block<Matrix<float, Size, Size>, Dynamic, 1, false>>& lhs, const float& rhs) { \
+		return lhs.operator==(rhs);                                                                                          \
+	}
+
+EIGEN_WRAPPER_LDLT_SCALAR_COMPARISONS(3)
+EIGEN_WRAPPER_LDLT_SCALAR_COMPARISONS(6)
+
+#undef EIGEN_WRAPPER_LDLT_SCALAR_COMPARISONS
+} // namespace Eigen
+
 
 class EigenWrapper {
 public:
@@ -13,12 +38,31 @@ public:
 	using Vec2 = Eigen::Vector2f;
 	using Vec3 = Eigen::Vector3f;
 	using Vec4 = Eigen::Vector4f;
+	using Vec6 = Eigen::Matrix<float, 6, 1>;
+	using Vec8 = Eigen::Matrix<float, 8, 1>;
+
+	using IVec3 = Eigen::Vector3i;
+	using IVec4 = Eigen::Vector4i;
 
 	using Mat22 = Eigen::Matrix<float, 2, 2>;
 	using Mat33 = Eigen::Matrix<float, 3, 3>;
 	using Mat44 = Eigen::Matrix<float, 4, 4>;
+	using Mat55 = Eigen::Matrix<float, 5, 5>;
+	using Mat66 = Eigen::Matrix<float, 6, 6>;
+	using Mat77 = Eigen::Matrix<float, 7, 7>;
+	using Mat88 = Eigen::Matrix<float, 8, 8>;
+	using Mat1616 = Eigen::Matrix<float, 16, 16>;
+	using Mat3232 = Eigen::Matrix<float, 32, 32>;
+	using Mat63 = Eigen::Matrix<float, 6, 3>;
 
 	using Quat = Eigen::Quaternion<float>;
+	// Eigen has no batched types, batches are plain arrays of single objects.
+	using QuatBatch = std::array<Quat, 8>;
+	using Mat33Batch = std::array<Mat33, 8>;
+	using Mat66Batch = std::array<Mat66, 8>;
+	using Vec3Batch = std::array<Vec3, 8>;
+	using Vec6Batch = std::array<Vec6, 8>;
+	using Vec2Array = std::array<Vec2, 8>;
 
 	//----------------------------------
 	// Vector binary operators
@@ -44,9 +88,89 @@ public:
 	template <class Vec>
 	static float NormV(const Vec& arg);
 
+	template <class Vec>
+	static float NormFastV(const Vec& arg);
+
 	template <class Vec>
 	static Vec NormalizeV(const Vec& arg);
 
+	template <class Vec>
+	static Vec NormalizeFastV(const Vec& arg);
+
+	/// <summary> Normalizes each of the 8 vectors. </summary>
+	static Vec2Array NormalizeArray(const Vec2Array& arg);
+
+	//----------------------------------
+	// Vector utility functions
+	//----------------------------------
+	template <class Vec>
+	static Vec MinVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec MaxVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec ClampV(const Vec& arg);
+
+	template <class Vec>
+	static Vec AbsV(const Vec& arg);
+
+	template <class Vec>
+	static Vec FloorV(const Vec& arg);
+
+	template <class Vec>
+	static Vec RoundV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LerpVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SmoothstepV(const Vec& arg);
+
+	//----------------------------------
+	// Vector comparison
+	//----------------------------------
+	template <class Vec>
+	static bool AnyLessVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SelectLessVV(const Vec& lhs, const Vec& rhs);
+
+	//----------------------------------
+	// Integer vectors
+	//----------------------------------
+	/// <summary> The integer part of fixed-point coordinates with 4 fractional bits. </summary>
+	template <class IVec>
+	static IVec ShiftRightV(const IVec& arg);
+
+	/// <summary> The grid cell of a position, with 16 cells per unit. </summary>
+	static IVec4 CellIndexV(const Vec4& position);
+
+	//----------------------------------
+	// Elementary functions
+	//----------------------------------
+	template <class Vec>
+	static Vec SinV(const Vec& arg);
+
+	template <class Vec>
+	static Vec CosV(const Vec& arg);
+
+	/// <summary> Sine and cosine of the same angles, as when building rotations. </summary>
+	template <class Vec>
+	static std::pair<Vec, Vec> SinCosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec Atan2VV(const Vec& y, const Vec& x);
+
+	template <class Vec>
+	static Vec AcosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec ExpV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LogV(const Vec& arg);
+
 	//----------------------------------
 	// Matrix binary operators
 	//----------------------------------
@@ -60,11 +184,32 @@ public:
 	template <class Mat>
 	static Mat AddMM(const Mat& lhs, const Mat& rhs);
 
+
+	//----------------------------------
+	// Matrix-vector operators
+	//----------------------------------
+	template <class Mat, class Vec>
+	static Vec MulMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec MulVM(const Vec& lhs, const Mat& rhs);
+
+	template <class Mat, class Vec>
+	static Vec TransformMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec TransformVM(const Vec& lhs, const Mat& rhs);
+
+
 	//----------------------------------
 	// Matrix unary operators
 	//----------------------------------
 	template <class Mat>
 	static auto Transpose(const Mat& arg);
+
+	/// <summary> Converts to the opposite memory layout, keeping the matrix the same. </summary>
+	template <class Mat>
+	static auto ConvertLayout(const Mat& arg);
 	
 	template <class Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
 	static auto Transpose_Impl(const Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>& arg)
@@ -76,12 +221,51 @@ public:
 	template <class Mat>
 	static auto Determinant(const Mat& arg);
 
+	template <class Mat>
+	static auto InverseDeterminant(const Mat& arg);
+
 	template <class Mat>
 	static auto Trace(const Mat& arg);
 
 	template <class Mat>
 	static Mat Pow3M(const Mat& arg);
 
+	//----------------------------------
+	// Quaternion operators
+	//----------------------------------
+	static Quat MulQQ(const Quat& lhs, const Quat& rhs);
+
+	template <class Vec>
+	static Vec RotateQV(const Quat& lhs, const Vec& rhs);
+
+	static Quat NormalizeQ(const Quat& arg);
+
+	static Quat ConjugateQ(const Quat& arg);
+
+	static Quat InverseQ(const Quat& arg);
+
+	template <class Mat>
+	static Mat ToMatrixQ(const Quat& arg);
+
+	template <class Mat>
+	static Quat FromMatrixQ(const Mat& arg);
+
+	static Quat ExpQ(const Quat& arg);
+
+	static Quat LogQ(const Quat& arg);
+
+	/// <summary> Raises the quaternion to the power of 0.5. </summary>
+	static Quat PowQ(const Quat& arg);
+
+	/// <summary> Interpolates 30% of the way from lhs to rhs. </summary>
+	static Quat SlerpQQ(const Quat& lhs, const Quat& rhs);
+
+	/// <summary> Slerps each of the 8 pairs 30% of the way from lhs to rhs. </summary>
+	static QuatBatch SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
+	/// <summary> Nlerps each of the 8 pairs 30% of the way from lhs to rhs, along the shorter arc. </summary>
+	static QuatBatch NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
 	//----------------------------------
 	// Extra
 	//----------------------------------
@@ -89,15 +273,96 @@ public:
 	template <class Mat>
 	static auto SingularValueDec(const Mat& arg);
 
+	/// <summary> Decomposes all 8 matrices. </summary>
+	static auto SingularValueDecBatch(const Mat33Batch& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of a symmetric matrix. </summary>
+	template <class Mat>
+	static auto EigenSymmetric(const Mat& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of all 8 symmetric matrices. </summary>
+	static auto EigenSymmetricBatch(const Mat33Batch& arg);
+
+	/// <summary> Rotation and stretch of a deformation gradient. </summary>
+	template <class Mat>
+	static auto PolarDec(const Mat& arg);
+
+	/// <summary> Householder QR, Q is not formed. </summary>
+	template <class Mat>
+	static auto QRDec(const Mat& arg);
+
+	/// <summary> Solves an overdetermined system in the least squares sense by QR. </summary>
+	template <class Mat, class Vec>
+	static auto LeastSquares(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a general system by the LU decomposition with partial pivoting. </summary>
+	template <class Mat, class Vec>
+	static Vec LUSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric positive definite system by the Cholesky decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec CholeskySolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric system by the LDL^T decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec LDLTSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves all 8 symmetric positive definite systems by the Cholesky decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs);
+
+	/// <summary> Solves all 8 symmetric systems by the LDL^T decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs);
+
 	//----------------------------------
 	// Utility
 	//----------------------------------
 	template <class Vec>
 	static void RandomVec(Vec& vec);
+
+	/// <summary> Fills the vector with integers between -1000 and 1000. </summary>
+	template <class Vec>
+	static void RandomIntVec(Vec& vec);
 	
+	/// <summary> Fills the vector with numbers between 0 and 2. </summary>
+	template <class Vec>
+	static void RandomPositiveVec(Vec& vec);
+
 	template <class Mat>
 	static void RandomMat(Mat& mat);
 
+	static void RandomQuat(Quat& quat);
+
+	static void RandomQuatBatch(QuatBatch& batch);
+
+	static void RandomVec2Array(Vec2Array& array);
+
+	static void RandomMatBatch(Mat33Batch& batch);
+
+	/// <summary> Fills the top-left 3x3 block with a random rotation, and the rest with the identity. </summary>
+	template <class Mat>
+	static void RandomRotation(Mat& mat);
+
+	template <class Mat>
+	static void RandomSymmetric(Mat& mat);
+
+	/// <summary> A random rotation times a random stretch close to the identity, like the deformation gradient of a soft body. </summary>
+	template <class Mat>
+	static void RandomDeformation(Mat& mat);
+
+	static void RandomSymmetricBatch(Mat33Batch& batch);
+
+	/// <summary> A random symmetric positive definite matrix, M * M^T + I. </summary>
+	template <class Mat>
+	static void RandomSPD(Mat& mat);
+
+	template <class MatBatch>
+	static void RandomSPDBatch(MatBatch& batch);
+
+	template <class VecBatch>
+	static void RandomVecBatch(VecBatch& batch);
+
 
 	//----------------------------------
 	// Members
@@ -118,7 +383,7 @@ Vec EigenWrapper::MulVV(const Vec& lhs, const Vec& rhs) {
 
 template <class Vec>
 Vec EigenWrapper::AddVV(const Vec& lhs, const Vec& rhs) {
-	return lhs.cwiseProduct(rhs);
+	return lhs + rhs;
 }
 
 template <class Vec>
@@ -141,11 +406,126 @@ float EigenWrapper::NormV(const Vec& arg) {
 	return arg.norm();
 }
 
+template <class Vec>
+float EigenWrapper::NormFastV(const Vec& arg) {
+	throw std::invalid_argument("not supported");
+}
+
 template <class Vec>
 Vec EigenWrapper::NormalizeV(const Vec& arg) {
 	return arg.normalized();
 }
 
+template <class Vec>
+Vec EigenWrapper::NormalizeFastV(const Vec& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+inline EigenWrapper::Vec2Array EigenWrapper::NormalizeArray(const Vec2Array& arg) {
+	Vec2Array result;
+	for (size_t i = 0; i < arg.size(); ++i) {
+		result[i] = NormalizeV(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec EigenWrapper::MinVV(const Vec& lhs, const Vec& rhs) {
+	return lhs.cwiseMin(rhs);
+}
+
+template <class Vec>
+Vec EigenWrapper::MaxVV(const Vec& lhs, const Vec& rhs) {
+	return lhs.cwiseMax(rhs);
+}
+
+template <class Vec>
+Vec EigenWrapper::ClampV(const Vec& arg) {
+	return arg.cwiseMin(0.5f).cwiseMax(-0.5f);
+}
+
+template <class Vec>
+Vec EigenWrapper::AbsV(const Vec& arg) {
+	return arg.cwiseAbs();
+}
+
+template <class Vec>
+Vec EigenWrapper::FloorV(const Vec& arg) {
+	return arg.array().floor().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::RoundV(const Vec& arg) {
+	return arg.array().round().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::LerpVV(const Vec& lhs, const Vec& rhs) {
+	return lhs + (rhs - lhs) * 0.25f;
+}
+
+template <class Vec>
+Vec EigenWrapper::SmoothstepV(const Vec& arg) {
+	const auto t = (arg.array() + 0.5f).cwiseMin(1.0f).cwiseMax(0.0f).eval();
+	return (t * t * (3.0f - 2.0f * t)).matrix();
+}
+
+template <class Vec>
+bool EigenWrapper::AnyLessVV(const Vec& lhs, const Vec& rhs) {
+	return (lhs.array() < rhs.array()).any();
+}
+
+template <class Vec>
+Vec EigenWrapper::SelectLessVV(const Vec& lhs, const Vec& rhs) {
+	return (lhs.array() < rhs.array()).select(rhs.array(), lhs.array()).matrix();
+}
+
+template <class IVec>
+IVec EigenWrapper::ShiftRightV(const IVec& arg) {
+	// This version of Eigen has no shift operators.
+	return arg.unaryExpr([](int32_t value) { return value >> 4; });
+}
+
+inline EigenWrapper::IVec4 EigenWrapper::CellIndexV(const Vec4& position) {
+	return (position * 16.0f).array().floor().template cast<int32_t>().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::SinV(const Vec& arg) {
+	return arg.array().sin().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::CosV(const Vec& arg) {
+	return arg.array().cos().matrix();
+}
+
+template <class Vec>
+std::pair<Vec, Vec> EigenWrapper::SinCosV(const Vec& arg) {
+	return { arg.array().sin().matrix(), arg.array().cos().matrix() };
+}
+
+template <class Vec>
+Vec EigenWrapper::Atan2VV(const Vec& y, const Vec& x) {
+	// This version of Eigen has no element-wise atan2.
+	return y.binaryExpr(x, [](float lhs, float rhs) { return std::atan2(lhs, rhs); });
+}
+
+template <class Vec>
+Vec EigenWrapper::AcosV(const Vec& arg) {
+	return arg.array().acos().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::ExpV(const Vec& arg) {
+	return arg.array().exp().matrix();
+}
+
+template <class Vec>
+Vec EigenWrapper::LogV(const Vec& arg) {
+	return arg.array().log().matrix();
+}
+
 template <class MatL, class MatR>
 auto EigenWrapper::MulMM(const MatL& lhs, const MatR& rhs) {
 	return MulMM_Impl(lhs, rhs);
@@ -162,6 +542,26 @@ Mat EigenWrapper::AddMM(const Mat& lhs, const Mat& rhs) {
 	return lhs + rhs;
 }
 
+template <class Mat, class Vec>
+Vec EigenWrapper::MulMV(const Mat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec, class Mat>
+Vec EigenWrapper::MulVM(const Vec& lhs, const Mat& rhs) {
+	return (lhs.transpose() * rhs).transpose();
+}
+
+template <class Mat, class Vec>
+Vec EigenWrapper::TransformMV(const Mat& lhs, const Vec& rhs) {
+	return (lhs * rhs.homogeneous()).hnormalized();
+}
+
+template <class Vec, class Mat>
+Vec EigenWrapper::TransformVM(const Vec& lhs, const Mat& rhs) {
+	return (lhs.homogeneous().transpose() * rhs).transpose().hnormalized();
+}
+
 template <class Mat>
 auto EigenWrapper::Transpose(const Mat& arg) {
 	return Transpose_Impl(arg);
@@ -172,6 +572,12 @@ auto EigenWrapper::Transpose_Impl(const Eigen::Matrix<Scalar, Rows, Cols, Option
 	return arg.transpose();
 }
 
+template <class Mat>
+auto EigenWrapper::ConvertLayout(const Mat& arg) {
+	constexpr int layout = Mat::IsRowMajor ? Eigen::ColMajor : Eigen::RowMajor;
+	return Eigen::Matrix<typename Mat::Scalar, Mat::RowsAtCompileTime, Mat::ColsAtCompileTime, layout>(arg);
+}
+
 template <class Mat>
 Mat EigenWrapper::Inverse(const Mat& arg) {
 	return arg.inverse();
@@ -182,6 +588,15 @@ auto EigenWrapper::Determinant(const Mat& arg) {
 	return arg.determinant();
 }
 
+template <class Mat>
+auto EigenWrapper::InverseDeterminant(const Mat& arg) {
+	Mat inverse;
+	typename Mat::Scalar determinant;
+	bool invertible;
+	arg.computeInverseAndDetWithCheck(inverse, determinant, invertible);
+	return std::pair{ inverse, determinant };
+}
+
 template <class Mat>
 auto EigenWrapper::Trace(const Mat& arg) {
 	return arg.trace();
@@ -192,9 +607,170 @@ Mat EigenWrapper::Pow3M(const Mat& arg) {
 	return arg * arg * arg;
 }
 
+inline EigenWrapper::Quat EigenWrapper::MulQQ(const Quat& lhs, const Quat& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec>
+Vec EigenWrapper::RotateQV(const Quat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+inline EigenWrapper::Quat EigenWrapper::NormalizeQ(const Quat& arg) {
+	return arg.normalized();
+}
+
+inline EigenWrapper::Quat EigenWrapper::ConjugateQ(const Quat& arg) {
+	return arg.conjugate();
+}
+
+inline EigenWrapper::Quat EigenWrapper::InverseQ(const Quat& arg) {
+	return arg.inverse();
+}
+
+template <class Mat>
+Mat EigenWrapper::ToMatrixQ(const Quat& arg) {
+	if constexpr (Mat::RowsAtCompileTime == 3) {
+		return arg.toRotationMatrix();
+	}
+	else {
+		Mat mat = Mat::Identity();
+		mat.template topLeftCorner<3, 3>() = arg.toRotationMatrix();
+		return mat;
+	}
+}
+
+template <class Mat>
+EigenWrapper::Quat EigenWrapper::FromMatrixQ(const Mat& arg) {
+	return Quat(arg);
+}
+
+inline EigenWrapper::Quat EigenWrapper::ExpQ(const Quat& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+inline EigenWrapper::Quat EigenWrapper::LogQ(const Quat& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+inline EigenWrapper::Quat EigenWrapper::PowQ(const Quat& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+inline EigenWrapper::Quat EigenWrapper::SlerpQQ(const Quat& lhs, const Quat& rhs) {
+	return lhs.slerp(0.3f, rhs);
+}
+
+inline EigenWrapper::QuatBatch EigenWrapper::SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	QuatBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = lhs[i].slerp(0.3f, rhs[i]);
+	}
+	return result;
+}
+
+inline EigenWrapper::QuatBatch EigenWrapper::NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	QuatBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		const float weightRhs = lhs[i].dot(rhs[i]) < 0.0f ? -0.3f : 0.3f;
+		result[i] = Quat(lhs[i].coeffs() * 0.7f + rhs[i].coeffs() * weightRhs).normalized();
+	}
+	return result;
+}
+
 template <class Mat>
 auto EigenWrapper::SingularValueDec(const Mat& arg) {
-	return arg.jacobiSvd();
+	// Mathter always computes U and V as well.
+	return arg.jacobiSvd(Eigen::ComputeFullU | Eigen::ComputeFullV);
+}
+
+inline auto EigenWrapper::SingularValueDecBatch(const Mat33Batch& arg) {
+	std::array<Eigen::JacobiSVD<Mat33>, 8> result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = SingularValueDec(arg[i]);
+	}
+	return result;
+}
+
+template <class Mat>
+auto EigenWrapper::EigenSymmetric(const Mat& arg) {
+	Eigen::SelfAdjointEigenSolver<Mat> solver;
+	// The closed form solution is only available for 2x2 and 3x3.
+	if constexpr (Mat::RowsAtCompileTime <= 3) {
+		solver.computeDirect(arg);
+	}
+	else {
+		solver.compute(arg);
+	}
+	return solver;
+}
+
+inline auto EigenWrapper::EigenSymmetricBatch(const Mat33Batch& arg) {
+	std::array<Eigen::SelfAdjointEigenSolver<Mat33>, 8> result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = EigenSymmetric(arg[i]);
+	}
+	return result;
+}
+
+template <class Mat>
+auto EigenWrapper::PolarDec(const Mat& arg) {
+	// Eigen has no polar decomposition, the usual way is through the SVD.
+	Eigen::JacobiSVD<Mat> svd(arg, Eigen::ComputeFullU | Eigen::ComputeFullV);
+	const Mat rotation = svd.matrixU() * svd.matrixV().transpose();
+	const Mat stretch = svd.matrixV() * svd.singularValues().asDiagonal() * svd.matrixV().transpose();
+	return std::pair{ rotation, stretch };
+}
+
+template <class Mat>
+auto EigenWrapper::QRDec(const Mat& arg) {
+	return arg.householderQr();
+}
+
+template <class Mat, class Vec>
+auto EigenWrapper::LeastSquares(const Mat& lhs, const Vec& rhs) {
+	// HouseholderQR::solve copies through runtime-sized row blocks, which GCC flags with -Warray-bounds
+	// on fixed-size operands. Applying Q^T and back substituting with fixed-size blocks is the same solve.
+	constexpr int Rows = Mat::RowsAtCompileTime;
+	constexpr int Cols = Mat::ColsAtCompileTime;
+	const Eigen::HouseholderQR<Mat> qr(lhs);
+	Eigen::Matrix<float, Rows, 1> qtb = rhs;
+	qtb.applyOnTheLeft(qr.householderQ().transpose());
+	const Eigen::Matrix<float, Cols, 1> solution = qr.matrixQR().template topLeftCorner<Cols, Cols>().template triangularView<Eigen::Upper>().solve(qtb.template head<Cols>());
+	return solution;
+}
+
+template <class Mat, class Vec>
+Vec EigenWrapper::LUSolve(const Mat& lhs, const Vec& rhs) {
+	return lhs.partialPivLu().solve(rhs);
+}
+
+template <class Mat, class Vec>
+Vec EigenWrapper::CholeskySolve(const Mat& lhs, const Vec& rhs) {
+	return lhs.llt().solve(rhs);
+}
+
+template <class Mat, class Vec>
+Vec EigenWrapper::LDLTSolve(const Mat& lhs, const Vec& rhs) {
+	return lhs.ldlt().solve(rhs);
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch EigenWrapper::CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	VecBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = CholeskySolve(lhs[i], rhs[i]);
+	}
+	return result;
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch EigenWrapper::LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	VecBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = LDLTSolve(lhs[i], rhs[i]);
+	}
+	return result;
 }
 
 template <class Vec>
@@ -202,6 +778,20 @@ void EigenWrapper::RandomVec(Vec& vec) {
 	return RandomMat(vec);
 }
 
+template <class Vec>
+void EigenWrapper::RandomIntVec(Vec& vec) {
+	for (int i = 0; i < vec.size(); ++i) {
+		vec(i) = int32_t(rng(rne) * 1000);
+	}
+}
+
+template <class Vec>
+void EigenWrapper::RandomPositiveVec(Vec& vec) {
+	for (int i = 0; i < vec.size(); ++i) {
+		vec(i) = 1.0f + rng(rne);
+	}
+}
+
 template <class Mat>
 void EigenWrapper::RandomMat(Mat& mat) {
 	for (int j = 0; j < mat.cols(); ++j) {
@@ -210,3 +800,85 @@ void EigenWrapper::RandomMat(Mat& mat) {
 		}
 	}
 }
+
+inline void EigenWrapper::RandomQuat(Quat& quat) {
+	float w, x, y, z, lengthSquared;
+	do {
+		w = rng(rne);
+		x = rng(rne);
+		y = rng(rne);
+		z = rng(rne);
+		lengthSquared = w * w + x * x + y * y + z * z;
+	} while (lengthSquared < 1e-2f || lengthSquared > 1.0f);
+	const float invLength = 1.0f / std::sqrt(lengthSquared);
+	quat = Quat(w * invLength, x * invLength, y * invLength, z * invLength);
+}
+
+inline void EigenWrapper::RandomQuatBatch(QuatBatch& batch) {
+	for (auto& quat : batch) {
+		RandomQuat(quat);
+	}
+}
+
+inline void EigenWrapper::RandomVec2Array(Vec2Array& array) {
+	for (auto& vec : array) {
+		RandomVec(vec);
+	}
+}
+
+inline void EigenWrapper::RandomMatBatch(Mat33Batch& batch) {
+	for (auto& mat : batch) {
+		RandomMat(mat);
+	}
+}
+
+template <class Mat>
+void EigenWrapper::RandomRotation(Mat& mat) {
+	Quat quat;
+	RandomQuat(quat);
+	mat = Mat::Identity();
+	mat.template topLeftCorner<3, 3>() = quat.toRotationMatrix();
+}
+
+template <class Mat>
+void EigenWrapper::RandomSymmetric(Mat& mat) {
+	RandomMat(mat);
+	const Mat transpose = mat.transpose();
+	mat = (mat + transpose) * 0.5f;
+}
+
+inline void EigenWrapper::RandomSymmetricBatch(Mat33Batch& batch) {
+	for (auto& mat : batch) {
+		RandomSymmetric(mat);
+	}
+}
+
+template <class Mat>
+void EigenWrapper::RandomDeformation(Mat& mat) {
+	Mat stretch;
+	RandomMat(stretch);
+	stretch = Mat::Identity() + stretch * 0.25f;
+	RandomRotation(mat);
+	mat = mat * stretch;
+}
+
+template <class Mat>
+void EigenWrapper::RandomSPD(Mat& mat) {
+	Mat factor;
+	RandomMat(factor);
+	mat = factor * factor.transpose() + Mat::Identity();
+}
+
+template <class MatBatch>
+void EigenWrapper::RandomSPDBatch(MatBatch& batch) {
+	for (auto& mat : batch) {
+		RandomSPD(mat);
+	}
+}
+
+template <class VecBatch>
+void EigenWrapper::RandomVecBatch(VecBatch& batch) {
+	for (auto& vec : batch) {
+		RandomVec(vec);
+	}
+}
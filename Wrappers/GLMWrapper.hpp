@@ -2,9 +2,17 @@
 
 #define GLM_FORCE_INTRINSICS
 #include "../Libraries/glm/glm.hpp"
+#include "../Libraries/glm/gtc/quaternion.hpp"
+#include "../Libraries/glm/ext/quaternion_exponential.hpp"
+#include "../Libraries/glm/gtx/orthonormalize.hpp"
+#include "../Libraries/glm/gtx/fast_square_root.hpp"
 
+#include <array>
+#include <cmath>
 #include <random>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 class GLMWrapper {
 public:
@@ -14,12 +22,33 @@ public:
 	using Vec2 = glm::vec2;
 	using Vec3 = glm::vec3;
 	using Vec4 = glm::vec4;
+	/// <summary> GLM has no types above 4 dimensions, these only make the benchmarks compile. </summary>
+	using Vec6 = std::array<float, 6>;
+	using Vec8 = std::array<float, 8>;
+
+	using IVec3 = glm::ivec3;
+	using IVec4 = glm::ivec4;
 
 	using Mat22 = glm::mat2x2;
 	using Mat33 = glm::mat3x3;
 	using Mat44 = glm::mat4x4;
+	/// <summary> Placeholders, see Vec6. </summary>
+	using Mat55 = std::array<float, 25>;
+	using Mat66 = std::array<float, 36>;
+	using Mat77 = std::array<float, 49>;
+	using Mat88 = std::array<float, 64>;
+	using Mat1616 = std::array<float, 256>;
+	using Mat3232 = std::array<float, 1024>;
+	using Mat63 = std::array<float, 18>;
 
 	using Quat = glm::quat;
+	// GLM has no batched types, batches are plain arrays of single objects.
+	using QuatBatch = std::array<Quat, 8>;
+	using Mat33Batch = std::array<Mat33, 8>;
+	using Mat66Batch = std::array<Mat66, 8>;
+	using Vec3Batch = std::array<Vec3, 8>;
+	using Vec6Batch = std::array<Vec6, 8>;
+	using Vec2Array = std::array<Vec2, 8>;
 
 	//----------------------------------
 	// Vector binary operators
@@ -45,9 +74,89 @@ public:
 	template <class Vec>
 	static float NormV(const Vec& arg);
 
+	template <class Vec>
+	static float NormFastV(const Vec& arg);
+
 	template <class Vec>
 	static Vec NormalizeV(const Vec& arg);
 
+	template <class Vec>
+	static Vec NormalizeFastV(const Vec& arg);
+
+	/// <summary> Normalizes each of the 8 vectors. </summary>
+	static Vec2Array NormalizeArray(const Vec2Array& arg);
+
+	//----------------------------------
+	// Vector utility functions
+	//----------------------------------
+	template <class Vec>
+	static Vec MinVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec MaxVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec ClampV(const Vec& arg);
+
+	template <class Vec>
+	static Vec AbsV(const Vec& arg);
+
+	template <class Vec>
+	static Vec FloorV(const Vec& arg);
+
+	template <class Vec>
+	static Vec RoundV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LerpVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SmoothstepV(const Vec& arg);
+
+	//----------------------------------
+	// Vector comparison
+	//----------------------------------
+	template <class Vec>
+	static bool AnyLessVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SelectLessVV(const Vec& lhs, const Vec& rhs);
+
+	//----------------------------------
+	// Integer vectors
+	//----------------------------------
+	/// <summary> The integer part of fixed-point coordinates with 4 fractional bits. </summary>
+	template <class IVec>
+	static IVec ShiftRightV(const IVec& arg);
+
+	/// <summary> The grid cell of a position, with 16 cells per unit. </summary>
+	static IVec4 CellIndexV(const Vec4& position);
+
+	//----------------------------------
+	// Elementary functions
+	//----------------------------------
+	template <class Vec>
+	static Vec SinV(const Vec& arg);
+
+	template <class Vec>
+	static Vec CosV(const Vec& arg);
+
+	/// <summary> Sine and cosine of the same angles, as when building rotations. </summary>
+	template <class Vec>
+	static std::pair<Vec, Vec> SinCosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec Atan2VV(const Vec& y, const Vec& x);
+
+	template <class Vec>
+	static Vec AcosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec ExpV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LogV(const Vec& arg);
+
 	//----------------------------------
 	// Matrix binary operators
 	//----------------------------------
@@ -58,30 +167,131 @@ public:
 	static auto AddMM(const Mat& lhs, const Mat& rhs);
 
 
+	//----------------------------------
+	// Matrix-vector operators
+	//----------------------------------
+	template <class Mat, class Vec>
+	static Vec MulMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec MulVM(const Vec& lhs, const Mat& rhs);
+
+	template <class Mat, class Vec>
+	static Vec TransformMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec TransformVM(const Vec& lhs, const Mat& rhs);
+
+
 	//----------------------------------
 	// Matrix unary operators
 	//----------------------------------
 	template <class Mat>
 	static auto Transpose(const Mat& arg);
 
+	/// <summary> Converts to the opposite memory layout, keeping the matrix the same. </summary>
+	template <class Mat>
+	static auto ConvertLayout(const Mat& arg);
+
 	template <class Mat>
 	static Mat Inverse(const Mat& arg);
 
 	template <class Mat>
 	static auto Determinant(const Mat& arg);
 
+	template <class Mat>
+	static auto InverseDeterminant(const Mat& arg);
+
 	template <class Mat>
 	static auto Trace(const Mat& arg);
 
 	template <class Mat>
 	static Mat Pow3M(const Mat& arg);
 
+	//----------------------------------
+	// Quaternion operators
+	//----------------------------------
+	static Quat MulQQ(const Quat& lhs, const Quat& rhs);
+
+	template <class Vec>
+	static Vec RotateQV(const Quat& lhs, const Vec& rhs);
+
+	static Quat NormalizeQ(const Quat& arg);
+
+	static Quat ConjugateQ(const Quat& arg);
+
+	static Quat InverseQ(const Quat& arg);
+
+	template <class Mat>
+	static Mat ToMatrixQ(const Quat& arg);
+
+	template <class Mat>
+	static Quat FromMatrixQ(const Mat& arg);
+
+	static Quat ExpQ(const Quat& arg);
+
+	static Quat LogQ(const Quat& arg);
+
+	/// <summary> Raises the quaternion to the power of 0.5. </summary>
+	static Quat PowQ(const Quat& arg);
+
+	/// <summary> Interpolates 30% of the way from lhs to rhs. </summary>
+	static Quat SlerpQQ(const Quat& lhs, const Quat& rhs);
+
+	/// <summary> Slerps each of the 8 pairs 30% of the way from lhs to rhs. </summary>
+	static QuatBatch SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
+	/// <summary> Nlerps each of the 8 pairs 30% of the way from lhs to rhs, along the shorter arc. </summary>
+	static QuatBatch NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
 	//----------------------------------
 	// Extra
 	//----------------------------------
 	template <class Mat>
 	static void SingularValueDec(const Mat& arg);
 
+	/// <summary> Decomposes all 8 matrices. </summary>
+	static void SingularValueDecBatch(const Mat33Batch& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of a symmetric matrix. </summary>
+	template <class Mat>
+	static void EigenSymmetric(const Mat& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of all 8 symmetric matrices. </summary>
+	static void EigenSymmetricBatch(const Mat33Batch& arg);
+
+	/// <summary> Rotation and stretch of a deformation gradient. </summary>
+	template <class Mat>
+	static auto PolarDec(const Mat& arg);
+
+	/// <summary> Householder QR, Q is not formed. </summary>
+	template <class Mat>
+	static void QRDec(const Mat& arg);
+
+	/// <summary> Solves an overdetermined system in the least squares sense by QR. </summary>
+	template <class Mat, class Vec>
+	static void LeastSquares(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a general system by the LU decomposition with partial pivoting. </summary>
+	template <class Mat, class Vec>
+	static Vec LUSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric positive definite system by the Cholesky decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec CholeskySolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric system by the LDL^T decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec LDLTSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves all 8 symmetric positive definite systems by the Cholesky decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs);
+
+	/// <summary> Solves all 8 symmetric systems by the LDL^T decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs);
+
 
 	//----------------------------------
 	// Utility
@@ -89,9 +299,48 @@ public:
 	template <class Vec>
 	static void RandomVec(Vec& vec);
 
+	/// <summary> Fills the vector with integers between -1000 and 1000. </summary>
+	template <class Vec>
+	static void RandomIntVec(Vec& vec);
+
+	/// <summary> Fills the vector with numbers between 0 and 2. </summary>
+	template <class Vec>
+	static void RandomPositiveVec(Vec& vec);
+
 	template <class Mat>
 	static void RandomMat(Mat& mat);
 
+	static void RandomQuat(Quat& quat);
+
+	static void RandomQuatBatch(QuatBatch& batch);
+
+	static void RandomVec2Array(Vec2Array& array);
+
+	static void RandomMatBatch(Mat33Batch& batch);
+
+	/// <summary> Fills the top-left 3x3 block with a random rotation, and the rest with the identity. </summary>
+	template <class Mat>
+	static void RandomRotation(Mat& mat);
+
+	template <class Mat>
+	static void RandomSymmetric(Mat& mat);
+
+	/// <summary> A random rotation times a random stretch close to the identity, like the deformation gradient of a soft body. </summary>
+	template <class Mat>
+	static void RandomDeformation(Mat& mat);
+
+	static void RandomSymmetricBatch(Mat33Batch& batch);
+
+	/// <summary> A random symmetric positive definite matrix, M * M^T + I. </summary>
+	template <class Mat>
+	static void RandomSPD(Mat& mat);
+
+	template <class MatBatch>
+	static void RandomSPDBatch(MatBatch& batch);
+
+	template <class VecBatch>
+	static void RandomVecBatch(VecBatch& batch);
+
 
 	//----------------------------------
 	// Members
@@ -135,36 +384,264 @@ float GLMWrapper::NormV(const Vec& arg) {
 	return glm::length(arg);
 }
 
+template <class Vec>
+float GLMWrapper::NormFastV(const Vec& arg) {
+	return glm::fastLength(arg);
+}
+
 template <class Vec>
 Vec GLMWrapper::NormalizeV(const Vec& arg) {
 	return glm::normalize(arg);
 }
 
+template <class Vec>
+Vec GLMWrapper::NormalizeFastV(const Vec& arg) {
+	return glm::fastNormalize(arg);
+}
+
+inline GLMWrapper::Vec2Array GLMWrapper::NormalizeArray(const Vec2Array& arg) {
+	Vec2Array result;
+	for (size_t i = 0; i < arg.size(); ++i) {
+		result[i] = NormalizeV(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec GLMWrapper::MinVV(const Vec& lhs, const Vec& rhs) {
+	return glm::min(lhs, rhs);
+}
+
+template <class Vec>
+Vec GLMWrapper::MaxVV(const Vec& lhs, const Vec& rhs) {
+	return glm::max(lhs, rhs);
+}
+
+template <class Vec>
+Vec GLMWrapper::ClampV(const Vec& arg) {
+	return glm::clamp(arg, -0.5f, 0.5f);
+}
+
+template <class Vec>
+Vec GLMWrapper::AbsV(const Vec& arg) {
+	return glm::abs(arg);
+}
+
+template <class Vec>
+Vec GLMWrapper::FloorV(const Vec& arg) {
+	return glm::floor(arg);
+}
+
+template <class Vec>
+Vec GLMWrapper::RoundV(const Vec& arg) {
+	return glm::round(arg);
+}
+
+template <class Vec>
+Vec GLMWrapper::LerpVV(const Vec& lhs, const Vec& rhs) {
+	return glm::mix(lhs, rhs, 0.25f);
+}
+
+template <class Vec>
+Vec GLMWrapper::SmoothstepV(const Vec& arg) {
+	return glm::smoothstep(-0.5f, 0.5f, arg);
+}
+
+template <class Vec>
+bool GLMWrapper::AnyLessVV(const Vec& lhs, const Vec& rhs) {
+	return glm::any(glm::lessThan(lhs, rhs));
+}
+
+template <class Vec>
+Vec GLMWrapper::SelectLessVV(const Vec& lhs, const Vec& rhs) {
+	return glm::mix(lhs, rhs, glm::lessThan(lhs, rhs));
+}
+
+template <class IVec>
+IVec GLMWrapper::ShiftRightV(const IVec& arg) {
+	return arg >> 4;
+}
+
+inline GLMWrapper::IVec4 GLMWrapper::CellIndexV(const Vec4& position) {
+	return IVec4(glm::floor(position * 16.0f));
+}
+
+// glm::sin and the rest call the standard library for each element too,
+// the loops do the same for the placeholder types above 4 dimensions.
+template <class Vec>
+Vec GLMWrapper::SinV(const Vec& arg) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(arg) / sizeof(arg[0]); ++i) {
+		result[i] = std::sin(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec GLMWrapper::CosV(const Vec& arg) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(arg) / sizeof(arg[0]); ++i) {
+		result[i] = std::cos(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+std::pair<Vec, Vec> GLMWrapper::SinCosV(const Vec& arg) {
+	return { SinV(arg), CosV(arg) };
+}
+
+template <class Vec>
+Vec GLMWrapper::Atan2VV(const Vec& y, const Vec& x) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(x) / sizeof(x[0]); ++i) {
+		result[i] = std::atan2(y[i], x[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec GLMWrapper::AcosV(const Vec& arg) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(arg) / sizeof(arg[0]); ++i) {
+		result[i] = std::acos(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec GLMWrapper::ExpV(const Vec& arg) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(arg) / sizeof(arg[0]); ++i) {
+		result[i] = std::exp(arg[i]);
+	}
+	return result;
+}
+
+template <class Vec>
+Vec GLMWrapper::LogV(const Vec& arg) {
+	Vec result;
+	for (size_t i = 0; i < sizeof(arg) / sizeof(arg[0]); ++i) {
+		result[i] = std::log(arg[i]);
+	}
+	return result;
+}
+
 template <class MatL, class MatR>
 auto GLMWrapper::MulMM(const MatL& lhs, const MatR& rhs) {
 	return lhs * rhs;
 }
 
+template <>
+inline auto GLMWrapper::MulMM(const Mat88& lhs, const Mat88& rhs) {
+	throw std::invalid_argument("not supported");
+	return lhs;
+}
+
+template <>
+inline auto GLMWrapper::MulMM(const Mat1616& lhs, const Mat1616& rhs) {
+	throw std::invalid_argument("not supported");
+	return lhs;
+}
+
+template <>
+inline auto GLMWrapper::MulMM(const Mat3232& lhs, const Mat3232& rhs) {
+	throw std::invalid_argument("not supported");
+	return lhs;
+}
+
 template <class Mat>
 auto GLMWrapper::AddMM(const Mat& lhs, const Mat& rhs) {
 	return lhs + rhs;
 }
 
+template <class Mat, class Vec>
+Vec GLMWrapper::MulMV(const Mat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec, class Mat>
+Vec GLMWrapper::MulVM(const Vec& lhs, const Mat& rhs) {
+	return lhs * rhs;
+}
+
+template <class Mat, class Vec>
+Vec GLMWrapper::TransformMV(const Mat& lhs, const Vec& rhs) {
+	glm::vec4 result = lhs * glm::vec4(rhs, 1.0f);
+	return Vec(result) / result.w;
+}
+
+template <class Vec, class Mat>
+Vec GLMWrapper::TransformVM(const Vec& lhs, const Mat& rhs) {
+	glm::vec4 result = glm::vec4(lhs, 1.0f) * rhs;
+	return Vec(result) / result.w;
+}
+
 template <class Mat>
 auto GLMWrapper::Transpose(const Mat& arg) {
 	return glm::transpose(arg);
 }
 
+template <>
+inline auto GLMWrapper::Transpose(const Mat88& arg) {
+	throw std::invalid_argument("not supported");
+	return arg;
+}
+
+template <class Mat>
+auto GLMWrapper::ConvertLayout(const Mat& arg) {
+	// GLM is column major only.
+	throw std::invalid_argument("not supported");
+	return arg;
+}
+
 template <class Mat>
 Mat GLMWrapper::Inverse(const Mat& arg) {
 	return glm::inverse(arg);
 }
 
+template <>
+inline GLMWrapper::Mat55 GLMWrapper::Inverse(const Mat55& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <>
+inline GLMWrapper::Mat66 GLMWrapper::Inverse(const Mat66& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <>
+inline GLMWrapper::Mat77 GLMWrapper::Inverse(const Mat77& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <>
+inline GLMWrapper::Mat88 GLMWrapper::Inverse(const Mat88& arg) {
+	throw std::invalid_argument("not supported");
+}
+
 template <class Mat>
 auto GLMWrapper::Determinant(const Mat& arg) {
 	return glm::determinant(arg);
 }
 
+template <>
+inline auto GLMWrapper::Determinant(const Mat55& arg) {
+	throw std::invalid_argument("not supported");
+	return 0.0f;
+}
+
+template <>
+inline auto GLMWrapper::Determinant(const Mat66& arg) {
+	throw std::invalid_argument("not supported");
+	return 0.0f;
+}
+
+template <class Mat>
+auto GLMWrapper::InverseDeterminant(const Mat& arg) {
+	return std::pair{ glm::inverse(arg), glm::determinant(arg) };
+}
+
 template <class Mat>
 auto GLMWrapper::Trace(const Mat& arg) {
 	throw std::invalid_argument("not supported");
@@ -175,23 +652,239 @@ Mat GLMWrapper::Pow3M(const Mat& arg) {
 	return arg * arg * arg;
 }
 
+inline GLMWrapper::Quat GLMWrapper::MulQQ(const Quat& lhs, const Quat& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec>
+Vec GLMWrapper::RotateQV(const Quat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+inline GLMWrapper::Quat GLMWrapper::NormalizeQ(const Quat& arg) {
+	return glm::normalize(arg);
+}
+
+inline GLMWrapper::Quat GLMWrapper::ConjugateQ(const Quat& arg) {
+	return glm::conjugate(arg);
+}
+
+inline GLMWrapper::Quat GLMWrapper::InverseQ(const Quat& arg) {
+	return glm::inverse(arg);
+}
+
+template <class Mat>
+Mat GLMWrapper::ToMatrixQ(const Quat& arg) {
+	if constexpr (std::is_same_v<Mat, glm::mat4>) {
+		return glm::mat4_cast(arg);
+	}
+	else {
+		return glm::mat3_cast(arg);
+	}
+}
+
+template <class Mat>
+GLMWrapper::Quat GLMWrapper::FromMatrixQ(const Mat& arg) {
+	return glm::quat_cast(arg);
+}
+
+inline GLMWrapper::Quat GLMWrapper::ExpQ(const Quat& arg) {
+	return glm::exp(arg);
+}
+
+inline GLMWrapper::Quat GLMWrapper::LogQ(const Quat& arg) {
+	return glm::log(arg);
+}
+
+inline GLMWrapper::Quat GLMWrapper::PowQ(const Quat& arg) {
+	return glm::pow(arg, 0.5f);
+}
+
+inline GLMWrapper::Quat GLMWrapper::SlerpQQ(const Quat& lhs, const Quat& rhs) {
+	return glm::slerp(lhs, rhs, 0.3f);
+}
+
+inline GLMWrapper::QuatBatch GLMWrapper::SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	QuatBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		result[i] = glm::slerp(lhs[i], rhs[i], 0.3f);
+	}
+	return result;
+}
+
+inline GLMWrapper::QuatBatch GLMWrapper::NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	QuatBatch result;
+	for (size_t i = 0; i < result.size(); ++i) {
+		const float weightRhs = glm::dot(lhs[i], rhs[i]) < 0.0f ? -0.3f : 0.3f;
+		result[i] = glm::normalize(lhs[i] * 0.7f + rhs[i] * weightRhs);
+	}
+	return result;
+}
+
 template <class Mat>
 void GLMWrapper::SingularValueDec(const Mat& arg) {
 	throw std::invalid_argument("use decomposition module of GLM");
 }
 
+inline void GLMWrapper::SingularValueDecBatch(const Mat33Batch& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat>
+void GLMWrapper::EigenSymmetric(const Mat& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+inline void GLMWrapper::EigenSymmetricBatch(const Mat33Batch& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat>
+auto GLMWrapper::PolarDec(const Mat& arg) {
+	// GLM has no polar decomposition, the usual way to get a rotation is Gram-Schmidt.
+	// Unlike the polar decomposition, that keeps the direction of the first column, so the rotation is biased.
+	const Mat rotation = glm::orthonormalize(arg);
+	const Mat stretch = glm::transpose(rotation) * arg;
+	return std::pair{ rotation, stretch };
+}
+
+template <class Mat>
+void GLMWrapper::QRDec(const Mat& arg) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat, class Vec>
+void GLMWrapper::LeastSquares(const Mat& lhs, const Vec& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat, class Vec>
+Vec GLMWrapper::LUSolve(const Mat& lhs, const Vec& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat, class Vec>
+Vec GLMWrapper::CholeskySolve(const Mat& lhs, const Vec& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class Mat, class Vec>
+Vec GLMWrapper::LDLTSolve(const Mat& lhs, const Vec& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch GLMWrapper::CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch GLMWrapper::LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	throw std::invalid_argument("not supported");
+}
+
 template <class Vec>
 void GLMWrapper::RandomVec(Vec& vec) {
-	for (size_t i = 0; i < sizeof(vec) / sizeof(vec.x); ++i) {
+	for (size_t i = 0; i < sizeof(vec) / sizeof(vec[0]); ++i) {
 		vec[i] = rng(rne);
 	}
 }
 
+template <class Vec>
+void GLMWrapper::RandomIntVec(Vec& vec) {
+	for (size_t i = 0; i < sizeof(vec) / sizeof(vec[0]); ++i) {
+		vec[i] = int32_t(rng(rne) * 1000);
+	}
+}
+
+template <class Vec>
+void GLMWrapper::RandomPositiveVec(Vec& vec) {
+	for (size_t i = 0; i < sizeof(vec) / sizeof(vec[0]); ++i) {
+		vec[i] = 1.0f + rng(rne);
+	}
+}
+
 template <class Mat>
 void GLMWrapper::RandomMat(Mat& mat) {
-	using Scalar = std::decay_t<decltype(mat[0][0])>;
-	auto p = reinterpret_cast<Scalar*>(&mat);
-	for (size_t i = 0; i < sizeof(mat) / sizeof(Scalar); ++i) {
+	// Works on the placeholders as well.
+	auto p = reinterpret_cast<float*>(&mat);
+	for (size_t i = 0; i < sizeof(mat) / sizeof(float); ++i) {
 		p[i] = rng(rne);
 	}
 }
+
+inline void GLMWrapper::RandomQuat(Quat& quat) {
+	float w, x, y, z, lengthSquared;
+	do {
+		w = rng(rne);
+		x = rng(rne);
+		y = rng(rne);
+		z = rng(rne);
+		lengthSquared = w * w + x * x + y * y + z * z;
+	} while (lengthSquared < 1e-2f || lengthSquared > 1.0f);
+	const float invLength = 1.0f / std::sqrt(lengthSquared);
+	quat = Quat(w * invLength, x * invLength, y * invLength, z * invLength);
+}
+
+inline void GLMWrapper::RandomQuatBatch(QuatBatch& batch) {
+	for (auto& quat : batch) {
+		RandomQuat(quat);
+	}
+}
+
+inline void GLMWrapper::RandomVec2Array(Vec2Array& array) {
+	for (auto& vec : array) {
+		RandomVec(vec);
+	}
+}
+
+inline void GLMWrapper::RandomMatBatch(Mat33Batch& batch) {
+	for (auto& mat : batch) {
+		RandomMat(mat);
+	}
+}
+
+template <class Mat>
+void GLMWrapper::RandomRotation(Mat& mat) {
+	Quat quat;
+	RandomQuat(quat);
+	mat = Mat(glm::mat3_cast(quat));
+}
+
+template <class Mat>
+void GLMWrapper::RandomSymmetric(Mat& mat) {
+	RandomMat(mat);
+	mat = (mat + glm::transpose(mat)) * 0.5f;
+}
+
+inline void GLMWrapper::RandomSymmetricBatch(Mat33Batch& batch) {
+	for (auto& mat : batch) {
+		RandomSymmetric(mat);
+	}
+}
+
+template <class Mat>
+void GLMWrapper::RandomDeformation(Mat& mat) {
+	Mat stretch;
+	RandomMat(stretch);
+	stretch = Mat(1.0f) + stretch * 0.25f;
+	RandomRotation(mat);
+	mat = mat * stretch;
+}
+
+template <class Mat>
+void GLMWrapper::RandomSPD(Mat& mat) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class MatBatch>
+void GLMWrapper::RandomSPDBatch(MatBatch& batch) {
+	throw std::invalid_argument("not supported");
+}
+
+template <class VecBatch>
+void GLMWrapper::RandomVecBatch(VecBatch& batch) {
+	for (auto& vec : batch) {
+		RandomVec(vec);
+	}
+}
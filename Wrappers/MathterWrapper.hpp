@@ -4,7 +4,11 @@
 #include "../Libraries/Mathter/Quaternion.hpp"
 #include "../Libraries/Mathter/Vector.hpp"
 
+#include <array>
+#include <cmath>
 #include <random>
+#include <type_traits>
+#include <utility>
 
 class MathterWrapper {
 public:
@@ -14,12 +18,31 @@ public:
 	using Vec2 = mathter::Vector<float, 2>;
 	using Vec3 = mathter::Vector<float, 3>;
 	using Vec4 = mathter::Vector<float, 4>;
+	using Vec6 = mathter::Vector<float, 6>;
+	using Vec8 = mathter::Vector<float, 8>;
+
+	using IVec3 = mathter::Vector<int32_t, 3>;
+	using IVec4 = mathter::Vector<int32_t, 4>;
 
 	using Mat22 = mathter::Matrix<float, 2, 2>;
 	using Mat33 = mathter::Matrix<float, 3, 3>;
 	using Mat44 = mathter::Matrix<float, 4, 4>;
+	using Mat55 = mathter::Matrix<float, 5, 5>;
+	using Mat66 = mathter::Matrix<float, 6, 6>;
+	using Mat77 = mathter::Matrix<float, 7, 7>;
+	using Mat88 = mathter::Matrix<float, 8, 8>;
+	using Mat1616 = mathter::Matrix<float, 16, 16>;
+	using Mat3232 = mathter::Matrix<float, 32, 32>;
+	using Mat63 = mathter::Matrix<float, 6, 3>;
 
 	using Quat = mathter::Quaternion<float>;
+	// Batches are structures of arrays with one object per SIMD lane.
+	using QuatBatch = mathter::QuaternionBatch<float, 8>;
+	using Mat33Batch = mathter::MatrixBatch<float, 3, 3, 8>;
+	using Mat66Batch = mathter::MatrixBatch<float, 6, 6, 8>;
+	using Vec3Batch = mathter::VectorBatch<float, 3, 8>;
+	using Vec6Batch = mathter::VectorBatch<float, 6, 8>;
+	using Vec2Array = std::array<Vec2, 8>;
 
 	//----------------------------------
 	// Vector binary operators
@@ -45,9 +68,89 @@ public:
 	template <class Vec>
 	static float NormV(const Vec& arg);
 
+	template <class Vec>
+	static float NormFastV(const Vec& arg);
+
 	template <class Vec>
 	static Vec NormalizeV(const Vec& arg);
 
+	template <class Vec>
+	static Vec NormalizeFastV(const Vec& arg);
+
+	/// <summary> Normalizes each of the 8 vectors. </summary>
+	static Vec2Array NormalizeArray(const Vec2Array& arg);
+
+	//----------------------------------
+	// Vector utility functions
+	//----------------------------------
+	template <class Vec>
+	static Vec MinVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec MaxVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec ClampV(const Vec& arg);
+
+	template <class Vec>
+	static Vec AbsV(const Vec& arg);
+
+	template <class Vec>
+	static Vec FloorV(const Vec& arg);
+
+	template <class Vec>
+	static Vec RoundV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LerpVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SmoothstepV(const Vec& arg);
+
+	//----------------------------------
+	// Vector comparison
+	//----------------------------------
+	template <class Vec>
+	static bool AnyLessVV(const Vec& lhs, const Vec& rhs);
+
+	template <class Vec>
+	static Vec SelectLessVV(const Vec& lhs, const Vec& rhs);
+
+	//----------------------------------
+	// Integer vectors
+	//----------------------------------
+	/// <summary> The integer part of fixed-point coordinates with 4 fractional bits. </summary>
+	template <class IVec>
+	static IVec ShiftRightV(const IVec& arg);
+
+	/// <summary> The grid cell of a position, with 16 cells per unit. </summary>
+	static IVec4 CellIndexV(const Vec4& position);
+
+	//----------------------------------
+	// Elementary functions
+	//----------------------------------
+	template <class Vec>
+	static Vec SinV(const Vec& arg);
+
+	template <class Vec>
+	static Vec CosV(const Vec& arg);
+
+	/// <summary> Sine and cosine of the same angles, as when building rotations. </summary>
+	template <class Vec>
+	static std::pair<Vec, Vec> SinCosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec Atan2VV(const Vec& y, const Vec& x);
+
+	template <class Vec>
+	static Vec AcosV(const Vec& arg);
+
+	template <class Vec>
+	static Vec ExpV(const Vec& arg);
+
+	template <class Vec>
+	static Vec LogV(const Vec& arg);
+
 	//----------------------------------
 	// Matrix binary operators
 	//----------------------------------
@@ -58,29 +161,130 @@ public:
 	static auto AddMM(const Mat& lhs, const Mat& rhs);
 
 
+	//----------------------------------
+	// Matrix-vector operators
+	//----------------------------------
+	template <class Mat, class Vec>
+	static Vec MulMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec MulVM(const Vec& lhs, const Mat& rhs);
+
+	template <class Mat, class Vec>
+	static Vec TransformMV(const Mat& lhs, const Vec& rhs);
+
+	template <class Vec, class Mat>
+	static Vec TransformVM(const Vec& lhs, const Mat& rhs);
+
+
 	//----------------------------------
 	// Matrix unary operators
 	//----------------------------------
 	template <class Mat>
 	static auto Transpose(const Mat& arg);
 
+	/// <summary> Converts to the opposite memory layout, keeping the matrix the same. </summary>
+	template <class Mat>
+	static auto ConvertLayout(const Mat& arg);
+
 	template <class Mat>
 	static Mat Inverse(const Mat& arg);
 
 	template <class Mat>
 	static auto Determinant(const Mat& arg);
 
+	template <class Mat>
+	static auto InverseDeterminant(const Mat& arg);
+
 	template <class Mat>
 	static auto Trace(const Mat& arg);
 
 	template <class Mat>
 	static Mat Pow3M(const Mat& arg);
 
+	//----------------------------------
+	// Quaternion operators
+	//----------------------------------
+	static Quat MulQQ(const Quat& lhs, const Quat& rhs);
+
+	template <class Vec>
+	static Vec RotateQV(const Quat& lhs, const Vec& rhs);
+
+	static Quat NormalizeQ(const Quat& arg);
+
+	static Quat ConjugateQ(const Quat& arg);
+
+	static Quat InverseQ(const Quat& arg);
+
+	template <class Mat>
+	static Mat ToMatrixQ(const Quat& arg);
+
+	template <class Mat>
+	static Quat FromMatrixQ(const Mat& arg);
+
+	static Quat ExpQ(const Quat& arg);
+
+	static Quat LogQ(const Quat& arg);
+
+	/// <summary> Raises the quaternion to the power of 0.5. </summary>
+	static Quat PowQ(const Quat& arg);
+
+	/// <summary> Interpolates 30% of the way from lhs to rhs. </summary>
+	static Quat SlerpQQ(const Quat& lhs, const Quat& rhs);
+
+	/// <summary> Slerps each of the 8 pairs 30% of the way from lhs to rhs. </summary>
+	static QuatBatch SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
+	/// <summary> Nlerps each of the 8 pairs 30% of the way from lhs to rhs, along the shorter arc. </summary>
+	static QuatBatch NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs);
+
 	//----------------------------------
 	// Extra
 	//----------------------------------
 	template <class Mat>
 	static auto SingularValueDec(const Mat& arg);
+
+	/// <summary> Decomposes all 8 matrices. </summary>
+	static auto SingularValueDecBatch(const Mat33Batch& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of a symmetric matrix. </summary>
+	template <class Mat>
+	static auto EigenSymmetric(const Mat& arg);
+
+	/// <summary> Eigenvalues and eigenvectors of all 8 symmetric matrices. </summary>
+	static auto EigenSymmetricBatch(const Mat33Batch& arg);
+
+	/// <summary> Rotation and stretch of a deformation gradient. </summary>
+	template <class Mat>
+	static auto PolarDec(const Mat& arg);
+
+	/// <summary> Householder QR, Q is not formed. </summary>
+	template <class Mat>
+	static auto QRDec(const Mat& arg);
+
+	/// <summary> Solves an overdetermined system in the least squares sense by QR. </summary>
+	template <class Mat, class Vec>
+	static auto LeastSquares(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a general system by the LU decomposition with partial pivoting. </summary>
+	template <class Mat, class Vec>
+	static Vec LUSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric positive definite system by the Cholesky decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec CholeskySolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves a symmetric system by the LDL^T decomposition. </summary>
+	template <class Mat, class Vec>
+	static Vec LDLTSolve(const Mat& lhs, const Vec& rhs);
+
+	/// <summary> Solves all 8 symmetric positive definite systems by the Cholesky decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs);
+
+	/// <summary> Solves all 8 symmetric systems by the LDL^T decomposition. </summary>
+	template <class MatBatch, class VecBatch>
+	static VecBatch LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs);
 	
 
 	//----------------------------------
@@ -89,9 +293,48 @@ public:
 	template <class Vec>
 	static void RandomVec(Vec& vec);
 
+	/// <summary> Fills the vector with integers between -1000 and 1000. </summary>
+	template <class Vec>
+	static void RandomIntVec(Vec& vec);
+
+	/// <summary> Fills the vector with numbers between 0 and 2. </summary>
+	template <class Vec>
+	static void RandomPositiveVec(Vec& vec);
+
 	template <class Mat>
 	static void RandomMat(Mat& mat);
 
+	static void RandomQuat(Quat& quat);
+
+	static void RandomQuatBatch(QuatBatch& batch);
+
+	static void RandomVec2Array(Vec2Array& array);
+
+	static void RandomMatBatch(Mat33Batch& batch);
+
+	/// <summary> Fills the top-left 3x3 block with a random rotation, and the rest with the identity. </summary>
+	template <class Mat>
+	static void RandomRotation(Mat& mat);
+
+	template <class Mat>
+	static void RandomSymmetric(Mat& mat);
+
+	/// <summary> A random rotation times a random stretch close to the identity, like the deformation gradient of a soft body. </summary>
+	template <class Mat>
+	static void RandomDeformation(Mat& mat);
+
+	static void RandomSymmetricBatch(Mat33Batch& batch);
+
+	/// <summary> A random symmetric positive definite matrix, M * M^T + I. </summary>
+	template <class Mat>
+	static void RandomSPD(Mat& mat);
+
+	template <class MatBatch>
+	static void RandomSPDBatch(MatBatch& batch);
+
+	template <class VecBatch>
+	static void RandomVecBatch(VecBatch& batch);
+
 
 	//----------------------------------
 	// Members
@@ -135,11 +378,137 @@ float MathterWrapper::NormV(const Vec& arg) {
 	return Length(arg);
 }
 
+template <class Vec>
+float MathterWrapper::NormFastV(const Vec& arg) {
+	return Length<mathter::ePrecision::FAST>(arg);
+}
+
 template <class Vec>
 Vec MathterWrapper::NormalizeV(const Vec& arg) {
 	return Normalize(arg);
 }
 
+template <class Vec>
+Vec MathterWrapper::NormalizeFastV(const Vec& arg) {
+	return Normalize<mathter::ePrecision::FAST>(arg);
+}
+
+inline MathterWrapper::Vec2Array MathterWrapper::NormalizeArray(const Vec2Array& arg) {
+	Vec2Array result;
+#ifdef MATHTER_SSE2_HACK
+	// Two vectors share a register, so that one square root and one division serve both.
+	using Pair = mathter::Simd<float, 2>;
+	using Quad = mathter::Simd<float, 4>;
+	for (size_t i = 0; i < arg.size(); i += 2) {
+		Quad both;
+		both.reg = Pair::pack(arg[i].simd, arg[i + 1].simd);
+		const Quad squares = Quad::mul(both, both);
+		const Quad lengthSquared = Quad::add(squares, Quad::shuffle<2, 3, 0, 1>(squares));
+		const Quad normalized = Quad::div(both, Quad::sqrt(lengthSquared));
+		Pair::unpack(normalized.reg, result[i].simd, result[i + 1].simd);
+	}
+#else
+	for (size_t i = 0; i < arg.size(); ++i) {
+		result[i] = Normalize(arg[i]);
+	}
+#endif
+	return result;
+}
+
+template <class Vec>
+Vec MathterWrapper::MinVV(const Vec& lhs, const Vec& rhs) {
+	return Min(lhs, rhs);
+}
+
+template <class Vec>
+Vec MathterWrapper::MaxVV(const Vec& lhs, const Vec& rhs) {
+	return Max(lhs, rhs);
+}
+
+template <class Vec>
+Vec MathterWrapper::ClampV(const Vec& arg) {
+	return Clamp(arg, -0.5f, 0.5f);
+}
+
+template <class Vec>
+Vec MathterWrapper::AbsV(const Vec& arg) {
+	return Abs(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::FloorV(const Vec& arg) {
+	return Floor(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::RoundV(const Vec& arg) {
+	return Round(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::LerpVV(const Vec& lhs, const Vec& rhs) {
+	return Lerp(lhs, rhs, 0.25f);
+}
+
+template <class Vec>
+Vec MathterWrapper::SmoothstepV(const Vec& arg) {
+	return Smoothstep(-0.5f, 0.5f, arg);
+}
+
+template <class Vec>
+bool MathterWrapper::AnyLessVV(const Vec& lhs, const Vec& rhs) {
+	return Any(lhs < rhs);
+}
+
+template <class Vec>
+Vec MathterWrapper::SelectLessVV(const Vec& lhs, const Vec& rhs) {
+	return Select(lhs < rhs, rhs, lhs);
+}
+
+template <class IVec>
+IVec MathterWrapper::ShiftRightV(const IVec& arg) {
+	return arg >> 4;
+}
+
+inline MathterWrapper::IVec4 MathterWrapper::CellIndexV(const Vec4& position) {
+	return IVec4(Floor(position * 16.0f));
+}
+
+template <class Vec>
+Vec MathterWrapper::SinV(const Vec& arg) {
+	return Sin(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::CosV(const Vec& arg) {
+	return Cos(arg);
+}
+
+template <class Vec>
+std::pair<Vec, Vec> MathterWrapper::SinCosV(const Vec& arg) {
+	return SinCos(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::Atan2VV(const Vec& y, const Vec& x) {
+	return Atan2(y, x);
+}
+
+template <class Vec>
+Vec MathterWrapper::AcosV(const Vec& arg) {
+	return Acos(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::ExpV(const Vec& arg) {
+	return Exp(arg);
+}
+
+template <class Vec>
+Vec MathterWrapper::LogV(const Vec& arg) {
+	return Log(arg);
+}
+
 template <class MatL, class MatR>
 auto MathterWrapper::MulMM(const MatL& lhs, const MatR& rhs) {
 	return lhs * rhs;
@@ -150,11 +519,39 @@ auto MathterWrapper::AddMM(const Mat& lhs, const Mat& rhs) {
 	return lhs + rhs;
 }
 
+template <class Mat, class Vec>
+Vec MathterWrapper::MulMV(const Mat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec, class Mat>
+Vec MathterWrapper::MulVM(const Vec& lhs, const Mat& rhs) {
+	return lhs * rhs;
+}
+
+template <class Mat, class Vec>
+Vec MathterWrapper::TransformMV(const Mat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec, class Mat>
+Vec MathterWrapper::TransformVM(const Vec& lhs, const Mat& rhs) {
+	return lhs * rhs;
+}
+
 template <class Mat>
 auto MathterWrapper::Transpose(const Mat& arg) {
 	return mathter::Transpose(arg);
 }
 
+template <class Mat>
+auto MathterWrapper::ConvertLayout(const Mat& arg) {
+	using Traits = mathter::traits::MatrixTraits<Mat>;
+	using ResultT = mathter::Matrix<typename Traits::Type, Traits::Rows, Traits::Columns, Traits::Order,
+									mathter::traits::OppositeLayout<Traits::Layout>::value, Traits::Packed>;
+	return ResultT(arg);
+}
+
 template <class Mat>
 Mat MathterWrapper::Inverse(const Mat& arg) {
 	return mathter::Inverse(arg);
@@ -165,6 +562,13 @@ auto MathterWrapper::Determinant(const Mat& arg) {
 	return mathter::Determinant(arg);
 }
 
+template <class Mat>
+auto MathterWrapper::InverseDeterminant(const Mat& arg) {
+	typename mathter::traits::MatrixTraits<Mat>::Type determinant;
+	Mat inverse = mathter::Inverse(arg, determinant);
+	return std::pair{ inverse, determinant };
+}
+
 template <class Mat>
 auto MathterWrapper::Trace(const Mat& arg) {
 	return mathter::Trace(arg);
@@ -175,9 +579,126 @@ Mat MathterWrapper::Pow3M(const Mat& arg) {
 	return arg * arg * arg;
 }
 
+inline MathterWrapper::Quat MathterWrapper::MulQQ(const Quat& lhs, const Quat& rhs) {
+	return lhs * rhs;
+}
+
+template <class Vec>
+Vec MathterWrapper::RotateQV(const Quat& lhs, const Vec& rhs) {
+	return lhs * rhs;
+}
+
+inline MathterWrapper::Quat MathterWrapper::NormalizeQ(const Quat& arg) {
+	return mathter::Normalize(arg);
+}
+
+inline MathterWrapper::Quat MathterWrapper::ConjugateQ(const Quat& arg) {
+	return mathter::Conjugate(arg);
+}
+
+inline MathterWrapper::Quat MathterWrapper::InverseQ(const Quat& arg) {
+	return mathter::Inverse(arg);
+}
+
+template <class Mat>
+Mat MathterWrapper::ToMatrixQ(const Quat& arg) {
+	return Mat(arg);
+}
+
+template <class Mat>
+MathterWrapper::Quat MathterWrapper::FromMatrixQ(const Mat& arg) {
+	return Quat(arg);
+}
+
+inline MathterWrapper::Quat MathterWrapper::ExpQ(const Quat& arg) {
+	return mathter::Exp(arg);
+}
+
+inline MathterWrapper::Quat MathterWrapper::LogQ(const Quat& arg) {
+	return mathter::Log(arg);
+}
+
+inline MathterWrapper::Quat MathterWrapper::PowQ(const Quat& arg) {
+	return mathter::Pow(arg, 0.5f);
+}
+
+inline MathterWrapper::Quat MathterWrapper::SlerpQQ(const Quat& lhs, const Quat& rhs) {
+	return mathter::Slerp(lhs, rhs, 0.3f);
+}
+
+inline MathterWrapper::QuatBatch MathterWrapper::SlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	return mathter::Slerp(lhs, rhs, 0.3f);
+}
+
+inline MathterWrapper::QuatBatch MathterWrapper::NlerpBatch(const QuatBatch& lhs, const QuatBatch& rhs) {
+	return mathter::Nlerp(lhs, rhs, 0.3f);
+}
+
 template <class Mat>
 auto MathterWrapper::SingularValueDec(const Mat& arg) {
-	return DecomposeSVD(arg);
+	if constexpr (std::is_same_v<Mat, Mat33>) {
+		return DecomposeSVD3x3(arg);
+	}
+	else {
+		return DecomposeSVD(arg);
+	}
+}
+
+inline auto MathterWrapper::SingularValueDecBatch(const Mat33Batch& arg) {
+	return DecomposeSVD3x3(arg);
+}
+
+template <class Mat>
+auto MathterWrapper::EigenSymmetric(const Mat& arg) {
+	return DecomposeEigenSymmetric(arg);
+}
+
+inline auto MathterWrapper::EigenSymmetricBatch(const Mat33Batch& arg) {
+	return DecomposeEigenSymmetric(arg);
+}
+
+template <class Mat>
+auto MathterWrapper::PolarDec(const Mat& arg) {
+	return DecomposePolar(arg);
+}
+
+template <class Mat>
+auto MathterWrapper::QRDec(const Mat& arg) {
+	return DecomposeQRImplicit(arg);
+}
+
+template <class Mat, class Vec>
+auto MathterWrapper::LeastSquares(const Mat& lhs, const Vec& rhs) {
+	return DecomposeQRImplicit(lhs).Solve(rhs);
+}
+
+template <class Mat, class Vec>
+Vec MathterWrapper::LUSolve(const Mat& lhs, const Vec& rhs) {
+	return DecomposeLUP(lhs).Solve(rhs);
+}
+
+template <class Mat, class Vec>
+Vec MathterWrapper::CholeskySolve(const Mat& lhs, const Vec& rhs) {
+	return DecomposeCholesky(lhs).Solve(rhs);
+}
+
+template <class Mat, class Vec>
+Vec MathterWrapper::LDLTSolve(const Mat& lhs, const Vec& rhs) {
+	return DecomposeLDLT(lhs).Solve(rhs);
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch MathterWrapper::CholeskySolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	VecBatch result;
+	mathter::SolveCholesky(&lhs, &rhs, &result, 1);
+	return result;
+}
+
+template <class MatBatch, class VecBatch>
+VecBatch MathterWrapper::LDLTSolveBatch(const MatBatch& lhs, const VecBatch& rhs) {
+	VecBatch result;
+	mathter::SolveLDLT(&lhs, &rhs, &result, 1);
+	return result;
 }
 
 template <class Vec>
@@ -187,6 +708,20 @@ void MathterWrapper::RandomVec(Vec& vec) {
 	}
 }
 
+template <class Vec>
+void MathterWrapper::RandomIntVec(Vec& vec) {
+	for (auto& v : vec) {
+		v = int32_t(rng(rne) * 1000);
+	}
+}
+
+template <class Vec>
+void MathterWrapper::RandomPositiveVec(Vec& vec) {
+	for (auto& v : vec) {
+		v = 1.0f + rng(rne);
+	}
+}
+
 template <class Mat>
 void MathterWrapper::RandomMat(Mat& mat) {
 	for (int j = 0; j < mat.ColumnCount(); ++j) {
@@ -195,3 +730,93 @@ void MathterWrapper::RandomMat(Mat& mat) {
 		}
 	}
 }
+
+inline void MathterWrapper::RandomQuat(Quat& quat) {
+	float w, x, y, z, lengthSquared;
+	do {
+		w = rng(rne);
+		x = rng(rne);
+		y = rng(rne);
+		z = rng(rne);
+		lengthSquared = w * w + x * x + y * y + z * z;
+	} while (lengthSquared < 1e-2f || lengthSquared > 1.0f);
+	const float invLength = 1.0f / std::sqrt(lengthSquared);
+	quat = Quat(w * invLength, x * invLength, y * invLength, z * invLength);
+}
+
+inline void MathterWrapper::RandomQuatBatch(QuatBatch& batch) {
+	for (int lane = 0; lane < 8; ++lane) {
+		Quat quat;
+		RandomQuat(quat);
+		batch.Set(lane, quat);
+	}
+}
+
+inline void MathterWrapper::RandomVec2Array(Vec2Array& array) {
+	for (auto& vec : array) {
+		RandomVec(vec);
+	}
+}
+
+inline void MathterWrapper::RandomMatBatch(Mat33Batch& batch) {
+	for (int lane = 0; lane < 8; ++lane) {
+		Mat33 mat;
+		RandomMat(mat);
+		batch.Set(lane, mat);
+	}
+}
+
+template <class Mat>
+void MathterWrapper::RandomRotation(Mat& mat) {
+	Quat quat;
+	RandomQuat(quat);
+	mat = Mat(quat);
+}
+
+template <class Mat>
+void MathterWrapper::RandomSymmetric(Mat& mat) {
+	RandomMat(mat);
+	mat = (mat + Transpose(mat)) * 0.5f;
+}
+
+inline void MathterWrapper::RandomSymmetricBatch(Mat33Batch& batch) {
+	for (int lane = 0; lane < 8; ++lane) {
+		Mat33 mat;
+		RandomSymmetric(mat);
+		batch.Set(lane, mat);
+	}
+}
+
+template <class Mat>
+void MathterWrapper::RandomDeformation(Mat& mat) {
+	Mat stretch;
+	RandomMat(stretch);
+	stretch = Mat(mathter::Identity()) + stretch * 0.25f;
+	RandomRotation(mat);
+	mat = mat * stretch;
+}
+
+template <class Mat>
+void MathterWrapper::RandomSPD(Mat& mat) {
+	Mat factor;
+	RandomMat(factor);
+	mat = factor * Transpose(factor) + Mat(mathter::Identity());
+}
+
+template <class MatBatch>
+void MathterWrapper::RandomSPDBatch(MatBatch& batch) {
+	for (int lane = 0; lane < 8; ++lane) {
+		auto mat = batch.Get(lane);
+		RandomSPD(mat);
+		batch.Set(lane, mat);
+	}
+}
+
+template <class VecBatch>
+void MathterWrapper::RandomVecBatch(VecBatch& batch) {
+	for (int lane = 0; lane < 8; ++lane) {
+		auto vec = batch.Get(lane);
+		RandomVec(vec);
+		batch.Set(lane, vec);
+	}
+}
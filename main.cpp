@@ -6,6 +6,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <string_view>
 
 
 std::string MakeCSV(const std::vector<std::string>& libNames, const std::vector<std::vector<Result>>& results) {
@@ -38,7 +39,46 @@ std::string MakeCSV(const std::vector<std::string>& libNames, const std::vector<
 }
 
 
-std::string MakeMarkdown(const std::vector<std::string>& libNames, const std::vector<std::vector<Result>>& results) {
+std::string FormatMinCycles(const Measurement& timing) {
+	std::stringstream text;
+	text << std::fixed << std::setprecision(3) << timing.minCyclesPerOp;
+	return text.str();
+}
+
+
+std::string FormatPlacement(const Measurement& timing) {
+	std::stringstream text;
+	text << std::fixed << std::setprecision(1) << 100.0 * timing.lineSplitRatio << "% split @" << timing.alignment;
+	if (timing.pageSize >= 1024 * 1024) {
+		text << ", " << timing.pageSize / (1024 * 1024) << " MiB pages";
+	}
+	else {
+		text << ", " << timing.pageSize / 1024 << " KiB pages";
+	}
+	return text.str();
+}
+
+
+std::string FormatContamination(const Measurement& timing) {
+	return std::to_string(timing.numContaminated) + " contaminated, " + std::to_string(timing.numTimesRun) + " used";
+}
+
+
+bool HasContamination(const std::vector<std::vector<Result>>& results) {
+	for (const auto& libResults : results) {
+		for (const auto& result : libResults) {
+			if (result.timing.numContaminated != 0) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+
+std::string MakeMarkdown(const std::vector<std::string>& libNames,
+						 const std::vector<std::vector<Result>>& results,
+						 std::string (*format)(const Measurement&) = &FormatMinCycles) {
 	const size_t numClasses = results[0].size();
 	const size_t numLibraries = results.size();
 
@@ -58,9 +98,9 @@ std::string MakeMarkdown(const std::vector<std::string>& libNames, const std::ve
 	for (size_t classIndex = 0; classIndex < numClasses; ++classIndex) {
 		markdownText << "|" << results[0][classIndex].name;
 		for (size_t libIndex = 0; libIndex < numLibraries; ++libIndex) {
-			double time = results[libIndex][classIndex].timing.minCyclesPerOp;
-			if (time != 0) {
-				markdownText << "|" << std::fixed << std::setprecision(3) << time;
+			const Measurement& timing = results[libIndex][classIndex].timing;
+			if (timing.minCyclesPerOp != 0) {
+				markdownText << "|" << format(timing);
 			}
 			else {
 				markdownText << "|" << "N/A";
@@ -96,38 +136,259 @@ std::vector<std::vector<Result>> NormalizeTimes(std::vector<std::vector<Result>>
 }
 
 
-int main() {
-	std::cout << "[[ Initialize ]]" << std::endl;
-	SetPriority();
-	SetAffinity();
-	std::cout << "\n\n";
-	;
+template <class T>
+std::vector<T> Interleave(const std::vector<T>& first, const std::vector<T>& second) {
+	std::vector<T> interleaved;
+	for (size_t index = 0; index < first.size(); ++index) {
+		interleaved.push_back(first[index]);
+		interleaved.push_back(second[index]);
+	}
+	return interleaved;
+}
+
+
+std::vector<std::vector<Result>> MeasureLibraries(const MeasureOptions& options, const std::string& label = "") {
 	std::vector<std::vector<Result>> results(3);
 
-	std::cout << "[[ Mathter... ]]";
-	results[0] = Config<MathterWrapper>();
+	std::cout << "[[ Mathter" << label << "... ]]";
+	results[0] = Config<MathterWrapper>(options);
 	std::cout << std::endl;
 
-	std::cout << "[[ Eigen... ]]";
-	results[1] = Config<EigenWrapper>();
+	std::cout << "[[ Eigen" << label << "... ]]";
+	results[1] = Config<EigenWrapper>(options);
 	std::cout << std::endl;
 
-	std::cout << "[[ GLM... ]]";
-	results[2] = Config<GLMWrapper>();
+	std::cout << "[[ GLM" << label << "... ]]";
+	results[2] = Config<GLMWrapper>(options);
 	std::cout << std::endl
 			  << "\n";
 
+	return results;
+}
+
+
+void MeasureSweep(const std::vector<std::string>& libNames,
+				  const std::vector<std::string>& variantNames,
+				  const std::vector<MeasureOptions>& variantOptions,
+				  bool showPlacement) {
+	std::vector<std::vector<std::vector<Result>>> variantResults;
+	for (size_t variantIndex = 0; variantIndex < variantOptions.size(); ++variantIndex) {
+		variantResults.push_back(MeasureLibraries(variantOptions[variantIndex], " " + variantNames[variantIndex]));
+	}
+
+	// One table per library, one column per variant
+	for (size_t libIndex = 0; libIndex < libNames.size(); ++libIndex) {
+		std::vector<std::vector<Result>> libResults;
+		for (const auto& results : variantResults) {
+			libResults.push_back(results[libIndex]);
+		}
+		std::cout << "### " << libNames[libIndex] << "\n\n";
+		std::cout << MakeMarkdown(variantNames, libResults) << std::endl;
+		if (showPlacement) {
+			std::cout << MakeMarkdown(variantNames, libResults, &FormatPlacement) << std::endl;
+		}
+		if (HasContamination(libResults)) {
+			std::cout << MakeMarkdown(variantNames, libResults, &FormatContamination) << std::endl;
+		}
+	}
+}
+
+
+/// <summary> Follows each variant by a cold copy of it, so that the sweep shows warm and cold results side by side. </summary>
+void AddColdVariants(std::vector<std::string>& variantNames,
+					 std::vector<MeasureOptions>& variantOptions,
+					 const MeasureOptions& coldOptions) {
+	std::vector<std::string> coldNames;
+	std::vector<MeasureOptions> coldVariants;
+	for (size_t variantIndex = 0; variantIndex < variantOptions.size(); ++variantIndex) {
+		MeasureOptions options = variantOptions[variantIndex];
+		options.cacheMode = coldOptions.cacheMode;
+		options.scrambleBranches = coldOptions.scrambleBranches;
+		coldNames.push_back(variantNames[variantIndex] + " cold");
+		coldVariants.push_back(options);
+	}
+	variantNames = Interleave(variantNames, coldNames);
+	variantOptions = Interleave(variantOptions, coldVariants);
+}
+
+
+const std::vector<std::pair<std::string, eAccessPattern>> accessPatternNames = {
+	{ "sequential", eAccessPattern::SEQUENTIAL },
+	{ "random", eAccessPattern::RANDOM },
+	{ "clustered", eAccessPattern::CLUSTERED },
+	{ "strided", eAccessPattern::STRIDED },
+};
+
+
+bool ParseAccessPatternArgument(std::string_view arg, eAccessPattern& pattern) {
+	std::string_view name = "--pattern=";
+	if (arg.substr(0, name.size()) != name) {
+		return false;
+	}
+	for (const auto& [patternName, value] : accessPatternNames) {
+		if (arg.substr(name.size()) == patternName) {
+			pattern = value;
+			return true;
+		}
+	}
+	throw std::invalid_argument("unknown access pattern");
+}
+
+
+bool ParseSizeArgument(std::string_view arg, std::string_view name, size_t& value) {
+	if (arg.substr(0, name.size()) != name) {
+		return false;
+	}
+	value = std::stoull(std::string(arg.substr(name.size())));
+	return true;
+}
+
+
+int main(int argc, char* argv[]) {
+	MeasureOptions warmOptions;
+	MeasureOptions coldOptions = { .cacheMode = eCacheMode::COLD };
+	bool measureCold = false;
+	bool customPlacement = false;
+	bool alignmentSweep = false;
+	bool patternSweep = false;
+	try {
+		for (int argIndex = 1; argIndex < argc; ++argIndex) {
+			std::string_view arg = argv[argIndex];
+			if (arg == "--cold") {
+				measureCold = true;
+			}
+			else if (arg == "--scramble-branches") {
+				measureCold = true;
+				coldOptions.scrambleBranches = true;
+			}
+			else if (ParseSizeArgument(arg, "--align=", warmOptions.placement.alignment)
+					 || ParseSizeArgument(arg, "--offset=", warmOptions.placement.offset)) {
+				customPlacement = true;
+			}
+			else if (arg == "--hugepages") {
+				warmOptions.placement.hugePages = true;
+				customPlacement = true;
+			}
+			else if (ParseSizeArgument(arg, "--size=", warmOptions.size)) {
+				customPlacement = true;
+			}
+			else if (arg == "--align-sweep") {
+				alignmentSweep = true;
+			}
+			else if (ParseAccessPatternArgument(arg, warmOptions.accessPattern)) {
+			}
+			else if (arg == "--pattern-sweep") {
+				patternSweep = true;
+			}
+			else {
+				throw std::invalid_argument("unknown argument");
+			}
+		}
+		const size_t alignment = warmOptions.placement.alignment;
+		if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+			throw std::invalid_argument("alignment must be a power of two");
+		}
+	}
+	catch (std::exception& ex) {
+		std::cout << "Invalid arguments: " << ex.what() << std::endl;
+		std::cout << "Usage: MathterBench [--cold] [--scramble-branches] [--align=N] [--offset=N] [--align-sweep] [--hugepages] [--size=N]"
+				  << " [--pattern=sequential|random|clustered|strided] [--pattern-sweep]" << std::endl;
+		return 1;
+	}
+	coldOptions.placement = warmOptions.placement;
+	coldOptions.size = warmOptions.size;
+	coldOptions.accessPattern = warmOptions.accessPattern;
+
+	std::cout << "[[ Initialize ]]" << std::endl;
+	SetPriority();
+	SetAffinity();
+	std::cout << "\n\n";
+
 	// Make a markdown
 	std::vector<std::string> libNames = {
 		"Mathter",
 		"Eigen",
 		"GLM",
 	};
-	std::cout << MakeMarkdown(libNames, results) << std::endl;
 
-	// Normalized results
-	auto normedResults = NormalizeTimes(results);
-	std::cout << MakeMarkdown(libNames, normedResults) << std::endl;
+	if (alignmentSweep) {
+		std::vector<std::string> placementNames;
+		std::vector<MeasureOptions> placementOptions;
+		for (size_t alignment : { 64, 32, 16, 4 }) {
+			MeasureOptions options = warmOptions;
+			options.placement.alignment = alignment;
+			std::string placementName = "align " + std::to_string(alignment);
+			if (options.placement.offset != 0) {
+				placementName += '+';
+				placementName += std::to_string(options.placement.offset);
+			}
+			placementNames.push_back(placementName);
+			placementOptions.push_back(options);
+		}
+		if (measureCold) {
+			AddColdVariants(placementNames, placementOptions, coldOptions);
+		}
+		MeasureSweep(libNames, placementNames, placementOptions, true);
+	}
+
+	if (patternSweep) {
+		std::vector<std::string> patternNames;
+		std::vector<MeasureOptions> patternOptions;
+		for (const auto& [patternName, pattern] : accessPatternNames) {
+			MeasureOptions options = warmOptions;
+			options.accessPattern = pattern;
+			patternNames.push_back(patternName);
+			patternOptions.push_back(options);
+		}
+		if (measureCold) {
+			AddColdVariants(patternNames, patternOptions, coldOptions);
+		}
+		MeasureSweep(libNames, patternNames, patternOptions, customPlacement);
+	}
+
+	if (alignmentSweep || patternSweep) {
+		return 0;
+	}
+
+	auto results = MeasureLibraries(warmOptions);
+
+	if (!measureCold) {
+		std::cout << MakeMarkdown(libNames, results) << std::endl;
+
+		// Normalized results
+		auto normedResults = NormalizeTimes(results);
+		std::cout << MakeMarkdown(libNames, normedResults) << std::endl;
+
+		if (customPlacement) {
+			std::cout << MakeMarkdown(libNames, results, &FormatPlacement) << std::endl;
+		}
+		if (HasContamination(results)) {
+			std::cout << MakeMarkdown(libNames, results, &FormatContamination) << std::endl;
+		}
+
+		return 0;
+	}
+
+	auto coldResults = MeasureLibraries(coldOptions, " cold");
+
+	// Warm and cold side by side
+	std::vector<std::string> coldNames;
+	for (const auto& libName : libNames) {
+		coldNames.push_back(libName + " cold");
+	}
+	auto sideBySideNames = Interleave(libNames, coldNames);
+	std::cout << MakeMarkdown(sideBySideNames, Interleave(results, coldResults)) << std::endl;
+
+	// Normalized results, warm and cold relative to the fastest library in the same mode
+	auto normedResults = Interleave(NormalizeTimes(results), NormalizeTimes(coldResults));
+	std::cout << MakeMarkdown(sideBySideNames, normedResults) << std::endl;
+
+	if (customPlacement) {
+		std::cout << MakeMarkdown(libNames, results, &FormatPlacement) << std::endl;
+	}
+	if (HasContamination(results) || HasContamination(coldResults)) {
+		std::cout << MakeMarkdown(sideBySideNames, Interleave(results, coldResults), &FormatContamination) << std::endl;
+	}
 
 	return 0;
 }